@@ -61,6 +61,9 @@ int main() {
 #define EFJSON_CONF_CHECK_INPUT_UTF 0
 #define EFJSON_CONF_COMBINE_ESCAPED_SURROGATE 1
 #define EFJSON_CONF_CHECK_ESCAPE_UTF 1
+#define EFJSON_CONF_NUMBER_VALUE 1
+#define EFJSON_CONF_NUMBER_SPAN 1
+#define EFJSON_CONF_LIMITS 1
 // #define EFJSON_CONF_EXTENDED_JSON 1
 #define EFJSON_STREAM_IMPL
 #include "efjson_stream.h"
@@ -74,8 +77,38 @@ int main() {
 #include <concepts>
 #include <iterator>
 #include <iostream>
+#include <fstream>
 #include <variant>
 #include <unordered_map>
+#include <optional>
+#include <charconv>
+#include <limits>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <type_traits>
+#include <bit>
+#include <memory>
+#include <filesystem>
+#include <system_error>
+#include <cerrno>
+#include <cstdio>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <atomic>
+#include <thread>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
 
 namespace efjson {
 
@@ -160,6 +193,11 @@ enum class Error : uint8_t {
   AllocFailed = efjsonError_ALLOC_FAILED,
   TooManyRecursions = efjsonError_TOO_MANY_RECURSIONS,
   PositionOverflow = efjsonError_POSITION_OVERFLOW,
+  TooDeep = efjsonError_TOO_DEEP,
+  StringTooLong = efjsonError_STRING_TOO_LONG,
+  NumberTooLong = efjsonError_NUMBER_TOO_LONG,
+  TooManyValues = efjsonError_TOO_MANY_VALUES,
+  InputTooLong = efjsonError_INPUT_TOO_LONG,
   CommentForbidden = efjsonError_COMMENT_FORBIDDEN,
   Eof = efjsonError_EOF,
   NonwhitespaceAfterEnd = efjsonError_NONWHITESPACE_AFTER_END,
@@ -209,6 +247,14 @@ enum class Stage : int8_t {
   Ended = efjsonStage_ENDED,
 };
 
+enum class Encoding : uint8_t {
+  Utf8 = efjsonEncoding_UTF8,
+  Utf16LE = efjsonEncoding_UTF16LE,
+  Utf16BE = efjsonEncoding_UTF16BE,
+  Utf32LE = efjsonEncoding_UTF32LE,
+  Utf32BE = efjsonEncoding_UTF32BE,
+};
+
 
 class StreamParserBase {
 public:
@@ -260,6 +306,53 @@ public:
   auto getStage() const noexcept {
     return static_cast<Stage>(efjsonStreamParser_getStage(&parser));
   }
+  auto getLocation() const noexcept {
+    return static_cast<Location>(efjsonStreamParser_getLocation(&parser));
+  }
+  auto getDepth() const noexcept {
+    return efjsonStreamParser_getDepth(&parser);
+  }
+  /** value of the last number once it's ended, `std::nullopt` if it's not an integer or out of range */
+  std::optional<int64_t> getInt64() const noexcept {
+    efjsonInt64 value;
+    if(!efjsonStreamParser_getInt64(&parser, &value)) return std::nullopt;
+    return static_cast<int64_t>(value);
+  }
+  /** value of the last number once it's ended, `std::nullopt` if its first 19 digits can't decide the rounding */
+  std::optional<double> getDouble() const noexcept {
+    double value;
+    if(!efjsonStreamParser_getDouble(&parser, &value)) return std::nullopt;
+    return value;
+  }
+  /**
+   * decode a run of `\\uXXXX` escapes inside a string in bulk, see `efjsonStreamParser_unescapeUtf8`
+   * @param dest `nullptr` to only validate
+   * @return the number of consumed bytes
+   */
+  size_t unescapeUtf8(char8_t* dest, size_t& written, std::u8string_view src) noexcept {
+    return efjsonStreamParser_unescapeUtf8(
+      &parser, reinterpret_cast<efjsonUint8*>(dest), &written, reinterpret_cast<const efjsonUint8*>(src.data()),
+      src.size()
+    );
+  }
+  /** start over as a new parser for another document, the option and the limits are kept */
+  void reset() noexcept {
+    efjsonUint32 option = parser.option;
+    efjsonLimits limits = parser.limits;
+    efjsonStreamParser_deinit(&parser);
+    efjsonStreamParser_init(&parser, option);
+    efjsonStreamParser_setLimits(&parser, &limits);
+  }
+  /** layout of the last number once it's ended, see `Number` */
+  efjsonNumberSpan getNumberSpan() const noexcept {
+    efjsonNumberSpan span;
+    efjsonStreamParser_getNumberSpan(&parser, &span);
+    return span;
+  }
+  /** fail as soon as the input exceeds one of `limits`, where 0 means unlimited, see `efjsonLimits` */
+  void setLimits(const efjsonLimits& limits) noexcept {
+    efjsonStreamParser_setLimits(&parser, &limits);
+  }
 
 protected:
   efjsonStreamParser parser;
@@ -295,6 +388,10 @@ class JsonUnicodeException : public std::runtime_error {
 public:
   explicit JsonUnicodeException(const std::string& msg) noexcept : std::runtime_error(msg) { }
 };
+class JsonValueException : public std::runtime_error {
+public:
+  explicit JsonValueException(const std::string& msg) noexcept : std::runtime_error(msg) { }
+};
 
 
 template<class First, class Last, class CharT>
@@ -329,6 +426,15 @@ public:
   efjsonUint32 character;
   efjsonToken token;
 };
+/** a handler of tokens, it may take the byte offset of each token's character as well (see `getOffset`) */
+template<class Fn>
+concept TokenHandler = std::invocable<Fn&, const Token&> || std::invocable<Fn&, const Token&, size_t>;
+template<TokenHandler Fn>
+void invokeTokenHandler(Fn& handler, const Token& token, size_t offset) {
+  if constexpr(std::invocable<Fn&, const Token&, size_t>) handler(token, offset);
+  else handler(token);
+}
+
 class StreamParser : public StreamParserBase {
 public:
   explicit StreamParser(efjsonUint32 option = 0) noexcept : StreamParserBase(option) { }
@@ -339,6 +445,21 @@ public:
   StreamParser& operator=(StreamParser&& other) noexcept(EFJSON_CONF_FIXED_STACK > 0) = default;
 
 public:
+  /**
+   * byte offset of the next character in the encoded input, counted by the bulk paths
+   * (`feedChunk`, `feedDetected`, `feedSome`, contiguous UTF-8 `feed` and the readers built on them);
+   * after a syntax error, the offset of the wrong character, and after invalid UTF-8/16/32, that of the broken sequence
+   * @note Characters fed one by one are not counted.
+   */
+  size_t getOffset() const noexcept {
+    return offset;
+  }
+  /** start over as a new parser for another document, the option and the limits are kept */
+  void reset() noexcept {
+    StreamParserBase::reset();
+    offset = 0;
+  }
+
   /** don't check if `u` is a valid codepoint */
   Token feedOneUnchecked(char32_t u) {
     efjsonToken token = efjsonStreamParser_feedOne(&parser, static_cast<efjsonUint32>(u));
@@ -357,6 +478,47 @@ public:
   Token end() {
     return feedOne(0);
   }
+  /**
+   * feed at most `budget` characters from the front of `src` and return, so a large input can be parsed in slices
+   * between other work; the parser keeps its state, pass the rest later
+   * (the characters are decoded and fed in bulk a block at a time, and `getOffset()` counts their bytes)
+   * @return the number of consumed code units, a character broken at the end of `src` is left unconsumed
+   */
+  template<class CharT, class OutIter>
+    requires(std::same_as<CharT, char32_t> || std::same_as<CharT, char16_t> || std::same_as<CharT, char8_t>)
+            && std::output_iterator<OutIter, Token>
+  size_t feedSome(std::basic_string_view<CharT> src, size_t budget, OutIter out) {
+    constexpr size_t BLOCK_SIZE = 1024, unit = sizeof(CharT);
+    const auto* bytes = reinterpret_cast<const efjsonUint8*>(src.data());
+    const int bigEndian = std::endian::native == std::endian::big;
+    efjsonToken tokens[BLOCK_SIZE];
+    efjsonUint32 chars[BLOCK_SIZE];
+    efjsonUtf8Decoder decoder8;
+    efjsonUtf16Decoder decoder16;
+    efjsonUtf8Decoder_init(&decoder8);
+    efjsonUtf16Decoder_init(&decoder16);
+    auto handler = [&](const Token& token) { *out++ = token; };
+    size_t fed = 0; /* bytes of the fed characters */
+    for(size_t block = 0; block < src.size() && budget != 0; block += BLOCK_SIZE) {
+      size_t len = std::min(BLOCK_SIZE, src.size() - block), consumed, count;
+      if constexpr(std::is_same_v<CharT, char8_t>)
+        count = efjsonUtf8Decoder_decode(&decoder8, chars, bytes + block, len, &consumed);
+      else if constexpr(std::is_same_v<CharT, char16_t>)
+        count = efjson_decodeUtf16(&decoder16, chars, bytes + block * unit, len, bigEndian, &consumed);
+      else count = efjson_decodeUtf32(chars, bytes + block * unit, len, bigEndian, &consumed);
+      bool spent = count >= budget; /* the budget ends before anything invalid after these characters */
+      count = std::min(count, budget);
+      budget -= count;
+      for(size_t i = 0; i < count; ++i) fed += encodedSize(chars[i], unit);
+      feedDecoded(handler, tokens, chars, count, unit);
+      if(consumed != len && !spent) {
+        throw JsonUnicodeException{
+          std::format("invalid UTF character: 0x{:X}", static_cast<uint32_t>(src[block + consumed]))
+        };
+      }
+    }
+    return fed / unit;
+  }
 
   template<class First, class Last, class OutIter>
     requires UtfIterator<First, Last, char32_t> && std::output_iterator<OutIter, Token>
@@ -390,6 +552,13 @@ public:
     efjsonUtf8Decoder decoder;
     efjsonUint32 u;
     efjsonUtf8Decoder_init(&decoder);
+    if constexpr(std::contiguous_iterator<First> && std::sized_sentinel_for<Last, First>) {
+      /* decoded in bulk, see `efjsonUtf8Decoder_decode` */
+      std::span<const char8_t> src(reinterpret_cast<const char8_t*>(std::to_address(first)), last - first);
+      feedChunk(decoder, src, [&](const Token& token) { *out++ = token; });
+      if(efjsonUtf8Decoder_feed(&decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+      return out;
+    }
     while(first != last) {
       char8_t c = static_cast<char8_t>(*first++);
       switch(efjsonUtf8Decoder_feed(&decoder, &u, c)) {
@@ -419,7 +588,2730 @@ public:
   std::vector<Token> feed(const Container& container) {
     return feed(std::ranges::begin(container), std::ranges::end(container));
   }
+  /**
+   * feed a chunk of UTF-8 text, `handler(token)` (or `handler(token, offset)`) is called for every token;
+   * a sequence cut at the end of `chunk` is carried over to the next chunk by `decoder`
+   */
+  template<TokenHandler Fn>
+  void feedChunk(efjsonUtf8Decoder& decoder, std::span<const char8_t> chunk, Fn&& handler) {
+    constexpr size_t BLOCK_SIZE = 1024;
+    efjsonToken tokens[BLOCK_SIZE];
+    efjsonUint32 chars[BLOCK_SIZE];
+    for(size_t block = 0; block < chunk.size(); block += BLOCK_SIZE) {
+      size_t len = std::min(BLOCK_SIZE, chunk.size() - block), consumed;
+      const auto* bytes = reinterpret_cast<const efjsonUint8*>(chunk.data() + block);
+      /* the characters before an invalid byte are fed first, so the first error is reported */
+      feedDecoded(handler, tokens, chars, efjsonUtf8Decoder_decode(&decoder, chars, bytes, len, &consumed), 1);
+      if(consumed != len) {
+        throw JsonUnicodeException{
+          std::format("invalid UTF-8 character: 0x{:02X}", static_cast<uint8_t>(bytes[consumed]))
+        };
+      }
+    }
+  }
+  /** feed UTF-8 text scattered over fragments (e.g. packets) as if it's contiguous, see `efjsonStreamParser_feedv` */
+  template<std::ranges::input_range Fragments, class OutIter>
+    requires std::convertible_to<std::ranges::range_reference_t<Fragments>, std::span<const char8_t>>
+             && std::output_iterator<OutIter, Token>
+  OutIter feed(Fragments&& fragments, OutIter out) {
+    efjsonUtf8Decoder decoder;
+    efjsonUint32 u;
+    efjsonUtf8Decoder_init(&decoder);
+    for(std::span<const char8_t> fragment: fragments)
+      feedChunk(decoder, fragment, [&](const Token& token) { *out++ = token; });
+    if(efjsonUtf8Decoder_feed(&decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+    return out;
+  }
+  template<std::ranges::input_range Fragments>
+    requires std::convertible_to<std::ranges::range_reference_t<Fragments>, std::span<const char8_t>>
+  std::vector<Token> feed(Fragments&& fragments) {
+    std::vector<Token> tokens;
+    feed(std::forward<Fragments>(fragments), std::back_inserter(tokens));
+    return tokens;
+  }
+  /**
+   * feed a document in UTF-8, UTF-16LE/BE or UTF-32LE/BE, detected by its BOM (which is skipped) or else by
+   * its zero bytes (see `efjson_detectEncoding`), `handler(token)` (or `handler(token, offset)`) is called for every
+   * token; UTF-16 and UTF-32 are transcoded block by block and fed in bulk, offsets count the BOM
+   * @return the detected encoding
+   */
+  template<TokenHandler Fn>
+  Encoding feedDetected(std::span<const char8_t> src, Fn&& handler) {
+    size_t bom;
+    const auto* bytes = reinterpret_cast<const efjsonUint8*>(src.data());
+    efjsonEncoding encoding = efjson_detectEncoding(bytes, src.size(), &bom);
+    efjsonUint32 u;
+    offset += bom;
+    if(encoding == efjsonEncoding_UTF8) {
+      efjsonUtf8Decoder decoder;
+      efjsonUtf8Decoder_init(&decoder);
+      feedChunk(decoder, src.subspan(bom), handler);
+      if(efjsonUtf8Decoder_feed(&decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+      return Encoding::Utf8;
+    }
+
+    constexpr size_t BLOCK_SIZE = 1024;
+    const bool wide = encoding == efjsonEncoding_UTF32LE || encoding == efjsonEncoding_UTF32BE;
+    const int bigEndian = encoding == efjsonEncoding_UTF16BE || encoding == efjsonEncoding_UTF32BE;
+    const size_t unit = wide ? 4 : 2, total = (src.size() - bom) / unit;
+    efjsonToken tokens[BLOCK_SIZE];
+    efjsonUint32 chars[BLOCK_SIZE];
+    efjsonUtf16Decoder decoder;
+    efjsonUtf16Decoder_init(&decoder);
+    if((src.size() - bom) % unit != 0)
+      throw JsonUnicodeException{ wide ? "broken UTF-32 sequence" : "broken UTF-16 sequence" };
+    bytes += bom;
+    for(size_t block = 0; block < total; block += BLOCK_SIZE) {
+      size_t len = std::min(BLOCK_SIZE, total - block), consumed;
+      size_t count = wide ? efjson_decodeUtf32(chars, bytes + block * unit, len, bigEndian, &consumed)
+                          : efjson_decodeUtf16(&decoder, chars, bytes + block * unit, len, bigEndian, &consumed);
+      /* as in `feedChunk`, the characters before an invalid unit are fed first */
+      feedDecoded(handler, tokens, chars, count, unit);
+      if(consumed != len) throw JsonUnicodeException{ wide ? "invalid UTF-32 character" : "invalid UTF-16 sequence" };
+    }
+    if(efjsonUtf16Decoder_feed(&decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-16 sequence" };
+    return static_cast<Encoding>(encoding);
+  }
+  std::vector<Token> feedDetected(std::span<const char8_t> src) {
+    std::vector<Token> tokens;
+    feedDetected(src, [&](const Token& token) { tokens.push_back(token); });
+    return tokens;
+  }
+
+protected:
+  /* the size of `u` in an input whose code units have `unit` bytes */
+  static size_t encodedSize(efjsonUint32 u, size_t unit) noexcept {
+    if(unit == 1) return u < 0x80u ? 1 : u < 0x800u ? 2 : u < 0x10000u ? 3 : 4;
+    return unit == 2 && u >= 0x10000u ? 4 : unit;
+  }
+  /* pass the tokens of `count` fed characters to `handler`, moving the offset past each character */
+  template<class Fn>
+  void emit(Fn& handler, const efjsonToken* tokens, const efjsonUint32* chars, size_t count, size_t unit) {
+    for(size_t i = 0; i < count; ++i) {
+      invokeTokenHandler(handler, Token(tokens[i], chars[i]), offset);
+      offset += encodedSize(chars[i], unit);
+    }
+  }
+  /*
+   * feed `count` decoded characters and pass their tokens to `handler`;
+   * on a syntax error, the tokens before it are passed and the offset is left at the wrong character
+   */
+  template<class Fn>
+  void feedDecoded(Fn& handler, efjsonToken* tokens, const efjsonUint32* chars, size_t count, size_t unit) {
+    efjsonPosition before = getPosition();
+    if(efjsonStreamParser_feed(&parser, tokens, chars, count) != 0 || count == 0) {
+      emit(handler, tokens, chars, count, unit);
+      return;
+    }
+    size_t index = getPosition() - before;
+    efjsonToken error = tokens[0];
+    tokens[0] = tokens[index]; /* the token of the first character, see `efjsonStreamParser_feed` */
+    emit(handler, tokens, chars, index, unit);
+    throw JsonStreamParserException(
+      static_cast<Error>(error.extra), static_cast<char32_t>(chars[index]), getPosition(), getLine(), getColumn()
+    );
+  }
+
+  size_t offset = 0;
+};
+
+
+/**
+ * Tracks the path of the current token while the tokens stream by, with O(1) work per token.
+ * Each depth keeps the index of the current element (or member), and the hash of the current key for objects,
+ * so handlers can route values by path without rebuilding it.
+ *
+ * A key is hashed as its decoded UTF-8 text (see `hashKey`), it's complete once its colon is met.
+ */
+class PathTracker {
+public:
+  struct Frame {
+    /** hash of the current key (objects only) */
+    uint64_t hash;
+    /** index of the current element, or of the current member for objects */
+    size_t index;
+    bool object;
+  };
+
+  static constexpr uint64_t HASH_BASIS = 0xCBF29CE484222325u;
+  static constexpr uint64_t HASH_PRIME = 0x100000001B3u;
+  /** FNV-1a hash of a key */
+  static constexpr uint64_t hashKey(std::u8string_view key) noexcept {
+    uint64_t hash = HASH_BASIS;
+    for(char8_t c: key) hash = (hash ^ static_cast<uint8_t>(c)) * HASH_PRIME;
+    return hash;
+  }
+
+public:
+  void feed(const Token& token) {
+    feed(token.token, token.character);
+  }
+  void feed(efjsonToken token, efjsonUint32 character) {
+    switch(token.type) {
+    case efjsonType_OBJECT_START:
+      frames.push_back(Frame{ HASH_BASIS, 0, true });
+      state = StateKey;
+      break;
+    case efjsonType_ARRAY_START:
+      frames.push_back(Frame{ 0, 0, false });
+      state = StateValue;
+      break;
+    case efjsonType_OBJECT_END:
+    case efjsonType_ARRAY_END:
+      frames.pop_back();
+      state = StateValue;
+      break;
+    case efjsonType_OBJECT_NEXT:
+      ++frames.back().index;
+      state = StateKey;
+      break;
+    case efjsonType_ARRAY_NEXT:
+      ++frames.back().index;
+      break;
+    case efjsonType_OBJECT_VALUE_START:
+      state = StateValue;
+      break;
+    case efjsonType_STRING_START:
+      if(state == StateKey) {
+        frames.back().hash = HASH_BASIS;
+        state = StateInKey;
+      }
+      break;
+    case efjsonType_STRING_NORMAL:
+      if(state == StateInKey) absorb(character);
+      break;
+    case efjsonType_STRING_ESCAPE:
+    case efjsonType_STRING_ESCAPE_UNICODE:
+      if(state == StateInKey && token.done) absorb(token.extra);
+      break;
+#if EFJSON_CONF_EXTENDED_JSON
+    case efjsonType_STRING_ESCAPE_HEX:
+      if(state == StateInKey && token.done) absorb(token.extra);
+      break;
+    case efjsonType_IDENTIFIER_NORMAL:
+    case efjsonType_IDENTIFIER_ESCAPE_START:
+    case efjsonType_IDENTIFIER_ESCAPE:
+      if(state == StateKey) { /* identifiers have no start token */
+        frames.back().hash = HASH_BASIS;
+        state = StateInKey;
+      }
+      if(token.type == efjsonType_IDENTIFIER_NORMAL) absorb(character);
+      else if(token.type == efjsonType_IDENTIFIER_ESCAPE && token.done) absorb(token.extra);
+      break;
+#endif
+    }
+  }
+  /** forget the path, for a new document */
+  void reset() noexcept {
+    frames.clear();
+    state = StateValue;
+  }
+
+  /** number of containers around the current token */
+  size_t depth() const noexcept {
+    return frames.size();
+  }
+  const Frame& operator[](size_t i) const noexcept {
+    return frames[i];
+  }
+  const Frame& back() const noexcept {
+    return frames.back();
+  }
+  /** whether the current token belongs to a key (or the whitespace before its colon) */
+  bool inKey() const noexcept {
+    return state != StateValue;
+  }
+
+private:
+  void absorb(efjsonUint32 u) noexcept {
+    uint64_t& hash = frames.back().hash;
+    /* surrogates are encoded like other codepoints, so lone ones still hash consistently */
+    if(u < 0x80u) hash = (hash ^ u) * HASH_PRIME;
+    else {
+      efjsonUint8 bytes[4];
+      int n;
+      if(u < 0x800u) {
+        bytes[0] = static_cast<efjsonUint8>(0xC0u | (u >> 6));
+        n = 1;
+      } else if(u < 0x10000u) {
+        bytes[0] = static_cast<efjsonUint8>(0xE0u | (u >> 12));
+        bytes[1] = static_cast<efjsonUint8>(0x80u | ((u >> 6) & 0x3Fu));
+        n = 2;
+      } else {
+        bytes[0] = static_cast<efjsonUint8>(0xF0u | (u >> 18));
+        bytes[1] = static_cast<efjsonUint8>(0x80u | ((u >> 12) & 0x3Fu));
+        bytes[2] = static_cast<efjsonUint8>(0x80u | ((u >> 6) & 0x3Fu));
+        n = 3;
+      }
+      bytes[n++] = static_cast<efjsonUint8>(0x80u | (u & 0x3Fu));
+      for(int i = 0; i < n; ++i) hash = (hash ^ bytes[i]) * HASH_PRIME;
+    }
+  }
+
+  enum State : uint8_t { StateValue, StateKey, StateInKey };
+  std::vector<Frame> frames;
+  State state = StateValue;
+};
+
+
+namespace {
+/** return 16 for non-hex digit */
+unsigned hexDigit(char8_t c) noexcept {
+  if(c >= u8'0' && c <= u8'9') return static_cast<unsigned>(c - u8'0');
+  if((c | 0x20) >= u8'a' && (c | 0x20) <= u8'f') return static_cast<unsigned>((c | 0x20) - u8'a' + 10);
+  return 16;
+}
+std::string toString(std::u8string_view str) {
+  return std::string(reinterpret_cast<const char*>(str.data()), str.size());
+}
+/** return the radix, and skip the prefix */
+unsigned radixOf(std::u8string_view text, size_t& i) noexcept {
+  unsigned radix = 10;
+  if(text.size() - i > 2 && text[i] == u8'0') {
+    switch(text[i + 1] | 0x20) {
+    case u8'x':
+      radix = 16;
+      break;
+    case u8'o':
+      radix = 8;
+      break;
+    case u8'b':
+      radix = 2;
+      break;
+    }
+  }
+  if(radix != 10) i += 2;
+  return radix;
+}
+/** return false if the number is not an integer or overflows */
+bool parseInteger(std::u8string_view text, bool& negative, uint64_t& magnitude) noexcept {
+  size_t i = 0;
+  negative = false;
+  magnitude = 0;
+  if(!text.empty() && (text[0] == u8'-' || text[0] == u8'+')) negative = text[i++] == u8'-';
+  unsigned radix = radixOf(text, i);
+  if(i == text.size()) return false;
+  for(; i < text.size(); ++i) {
+    unsigned digit = hexDigit(text[i]);
+    if(digit >= radix) return false;
+    if(magnitude > (std::numeric_limits<uint64_t>::max() - digit) / radix) return false;
+    magnitude = magnitude * radix + digit;
+  }
+  return true;
+}
+double parseDouble(std::u8string_view text) {
+  size_t i = 0;
+  bool negative = false;
+  double value = 0;
+  if(!text.empty() && (text[0] == u8'-' || text[0] == u8'+')) negative = text[i++] == u8'-';
+  if(i < text.size() && text[i] == u8'I') value = std::numeric_limits<double>::infinity();
+  else if(i < text.size() && text[i] == u8'N') value = std::numeric_limits<double>::quiet_NaN();
+  else if(unsigned radix = radixOf(text, i); radix != 10) {
+    for(; i < text.size(); ++i) value = value * radix + hexDigit(text[i]);
+  } else {
+    const char* first = reinterpret_cast<const char*>(text.data()) + i;
+    const char* last = reinterpret_cast<const char*>(text.data()) + text.size();
+    if(std::from_chars(first, last, value).ec == std::errc::result_out_of_range)
+      value = std::strtod(std::string(first, last).c_str(), nullptr);
+  }
+  return negative ? -value : value;
+}
+/** convert a number lexeme to the integer type `T`, throw if it's not an integer or out of range */
+template<class T>
+T toInteger(std::u8string_view text) {
+  bool negative;
+  uint64_t magnitude;
+  if(!parseInteger(text, negative, magnitude))
+    throw JsonValueException{ std::format("\"{}\" is not an integer", toString(text)) };
+  if(!negative) {
+    if(std::in_range<T>(magnitude)) return static_cast<T>(magnitude);
+  } else if(magnitude == 0) {
+    return 0;
+  } else if constexpr(std::is_signed_v<T>) {
+    if(magnitude - 1 <= static_cast<uint64_t>(std::numeric_limits<T>::max()))
+      return static_cast<T>(-static_cast<T>(magnitude - 1) - 1);
+  }
+  throw JsonValueException{ std::format("\"{}\" is out of range", toString(text)) };
+}
+
+/* arithmetic on decimal magnitudes without leading zeros, linear in their length */
+int compareMagnitude(std::string_view a, std::string_view b) noexcept {
+  if(a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+  return a.compare(b);
+}
+void addMagnitude(std::string& a, std::string_view b) {
+  if(a.size() < b.size()) a.insert(0, b.size() - a.size(), '0');
+  unsigned carry = 0;
+  size_t i = a.size();
+  for(size_t j = b.size(); j--;) {
+    unsigned digit = static_cast<unsigned>(a[--i] - '0') + static_cast<unsigned>(b[j] - '0') + carry;
+    carry = digit >= 10;
+    a[i] = static_cast<char>('0' + digit % 10);
+  }
+  for(; carry && i--;) {
+    if(a[i] == '9') a[i] = '0';
+    else ++a[i], carry = 0;
+  }
+  if(carry) a.insert(0, 1, '1');
+}
+/** `a -= b`, where `a >= b` */
+void subtractMagnitude(std::string& a, std::string_view b) {
+  unsigned borrow = 0;
+  for(size_t i = a.size(), j = b.size(); i-- && (j || borrow);) {
+    unsigned sub = borrow + (j ? static_cast<unsigned>(b[--j] - '0') : 0);
+    unsigned digit = static_cast<unsigned>(a[i] - '0');
+    borrow = digit < sub;
+    a[i] = static_cast<char>('0' + digit + (borrow ? 10 : 0) - sub);
+  }
+  size_t zeros = a.find_first_not_of('0');
+  a.erase(0, zeros == std::string::npos ? a.size() - 1 : zeros);
+}
+/** add `delta` to the decimal integer `(negative ? -1 : 1) * magnitude` */
+void addToDecimal(bool& negative, std::string& magnitude, int64_t delta) {
+  if(delta == 0) return;
+  bool deltaNegative = delta < 0;
+  std::string other = std::to_string(deltaNegative ? 0 - static_cast<uint64_t>(delta) : static_cast<uint64_t>(delta));
+  if(magnitude == "0") {
+    negative = deltaNegative;
+    magnitude = std::move(other);
+  } else if(negative == deltaNegative) {
+    addMagnitude(magnitude, other);
+  } else if(compareMagnitude(magnitude, other) >= 0) {
+    subtractMagnitude(magnitude, other);
+    if(magnitude == "0") negative = false;
+  } else {
+    subtractMagnitude(other, magnitude);
+    negative = deltaNegative;
+    magnitude = std::move(other);
+  }
+}
+}  // namespace
+
+
+/**
+ * A number kept as its lexeme and layout, so it's lossless whatever its length.
+ * Nothing is converted until one of the `to*` methods is called, each of them takes linear time
+ * (except `toString()` of a long hexadecimal/octal/binary integer).
+ * @note The number refers to the lexeme, it's only valid as long as the source text.
+ */
+class Number {
+public:
+  Number(std::u8string_view text, const efjsonNumberSpan& span) noexcept : text(text), span(span) { }
+
+  /** the source text of the number */
+  std::u8string_view raw() const noexcept {
+    return text;
+  }
+  const efjsonNumberSpan& layout() const noexcept {
+    return span;
+  }
+  bool isNegative() const noexcept {
+    return span.flag & efjsonNumberFlag_NEGATIVE;
+  }
+  /** whether it's written as an integer, i.e. no fraction or exponent part */
+  bool isInteger() const noexcept {
+    return !(span.flag & (efjsonNumberFlag_INFINITY | efjsonNumberFlag_NAN)) && span.fraction == span.length;
+  }
+  std::u8string_view integerDigits() const noexcept {
+    return text.substr(span.integer, span.integerDigits);
+  }
+  std::u8string_view fractionDigits() const noexcept {
+    return text.substr(span.fraction, span.fractionDigits);
+  }
+  std::u8string_view exponentDigits() const noexcept {
+    return text.substr(span.exponent, span.exponentDigits);
+  }
+
+  /** throw if it's not an integer or out of range */
+  int64_t toInt64() const {
+    return toInteger<int64_t>(text);
+  }
+  /** the correctly rounded value */
+  double toDouble() const {
+    if(span.flag
+       & (efjsonNumberFlag_INFINITY | efjsonNumberFlag_NAN | efjsonNumberFlag_HEXADECIMAL | efjsonNumberFlag_OCTAL
+          | efjsonNumberFlag_BINARY))
+      return parseDouble(text);
+    /* 0.DDD...e(point), only the first digits are needed, the rest just decide whether it's above a tie */
+    std::string buffer = isNegative() ? "-0." : "0.";
+    size_t count = 0;
+    int64_t point = static_cast<int64_t>(span.integerDigits);
+    bool sticky = false;
+    auto collect = [&](std::u8string_view digits) {
+      for(char8_t c : digits) {
+        if(count == 0 && c == u8'0') --point;
+        else if(++count <= MAX_DIGITS) buffer.push_back(static_cast<char>(c));
+        else if(c != u8'0') sticky = true;
+      }
+    };
+    collect(integerDigits());
+    collect(fractionDigits());
+    if(count == 0) return isNegative() ? -0.0 : 0.0;
+    if(sticky) buffer.push_back('1');
+    /* beyond the bound, the value is 0 or infinity anyway */
+    constexpr int64_t bound = 100000;
+    int64_t exponent = 0;
+    for(char8_t c : exponentDigits())
+      if((exponent = exponent * 10 + (c - u8'0')) > bound) break;
+    if(span.flag & efjsonNumberFlag_NEGATIVE_EXPONENT) exponent = -exponent;
+    point = std::clamp(point, -bound, bound) + exponent;
+    buffer.append("e").append(std::to_string(point));
+    return parseDouble(std::u8string_view(reinterpret_cast<const char8_t*>(buffer.data()), buffer.size()));
+  }
+  /**
+   * The exact value in the to-scientific-string form of the General Decimal Arithmetic specification
+   * (same as `str()` of Python's `decimal`), e.g. `123.4500`, `-1.5E+7`, `1E-7`, `0`.
+   * Trailing zeros are kept, as they carry the precision.
+   */
+  std::string toString() const {
+    std::string ret = isNegative() ? "-" : "";
+    if(span.flag & efjsonNumberFlag_INFINITY) return ret + "Infinity";
+    if(span.flag & efjsonNumberFlag_NAN) return ret + "NaN";
+    if(span.flag & (efjsonNumberFlag_HEXADECIMAL | efjsonNumberFlag_OCTAL | efjsonNumberFlag_BINARY))
+      return ret + radixToDecimal();
+
+    std::string coefficient;
+    coefficient.reserve(span.integerDigits + span.fractionDigits);
+    for(char8_t c : integerDigits())
+      if(!coefficient.empty() || c != u8'0') coefficient.push_back(static_cast<char>(c));
+    for(char8_t c : fractionDigits())
+      if(!coefficient.empty() || c != u8'0') coefficient.push_back(static_cast<char>(c));
+    if(coefficient.empty()) coefficient = "0";
+
+    /* the value is coefficient * 10^q, q = exponent - fractionDigits */
+    bool negative = span.flag & efjsonNumberFlag_NEGATIVE_EXPONENT;
+    std::u8string_view digits = exponentDigits();
+    digits.remove_prefix(std::min(digits.find_first_not_of(u8'0'), digits.size()));
+    std::string exponent(reinterpret_cast<const char*>(digits.data()), digits.size());
+    if(exponent.empty()) {
+      exponent = "0";
+      negative = false;
+    }
+    addToDecimal(negative, exponent, -static_cast<int64_t>(span.fractionDigits));
+    if((negative || exponent == "0") && exponent.size() <= 18) {
+      /* plain notation if the adjusted exponent is not less than -6 */
+      size_t q = static_cast<size_t>(std::stoull(exponent));
+      if(q == 0) return ret + coefficient;
+      if(q <= coefficient.size()) {
+        coefficient.insert(coefficient.size() - q, 1, '.');
+        if(coefficient[0] == '.') coefficient.insert(0, 1, '0');
+        return ret + coefficient;
+      }
+      if(q - coefficient.size() <= 5) return ret + "0." + std::string(q - coefficient.size(), '0') + coefficient;
+    }
+    addToDecimal(negative, exponent, static_cast<int64_t>(coefficient.size() - 1));
+    ret += coefficient[0];
+    if(coefficient.size() > 1) ret.append(".").append(coefficient, 1);
+    return ret.append(negative ? "E-" : "E+").append(exponent);
+  }
+
+private:
+  /* enough to decide the rounding of any double (at most 767 significant digits) */
+  static constexpr size_t MAX_DIGITS = 800;
+
+  std::string radixToDecimal() const {
+    const unsigned bits = span.flag & efjsonNumberFlag_HEXADECIMAL ? 4 : span.flag & efjsonNumberFlag_OCTAL ? 3 : 1;
+    std::vector<uint32_t> limbs; /* base 10^9, from the lowest */
+    for(char8_t c : integerDigits()) {
+      uint64_t carry = hexDigit(c);
+      for(uint32_t& limb : limbs) {
+        carry += static_cast<uint64_t>(limb) << bits;
+        limb = static_cast<uint32_t>(carry % 1000000000u);
+        carry /= 1000000000u;
+      }
+      if(carry) limbs.push_back(static_cast<uint32_t>(carry));
+    }
+    if(limbs.empty()) return "0";
+    std::string ret = std::to_string(limbs.back());
+    for(size_t i = limbs.size() - 1; i--;) {
+      std::string limb = std::to_string(limbs[i]);
+      ret.append(9 - limb.size(), '0').append(limb);
+    }
+    return ret;
+  }
+
+  std::u8string_view text;
+  efjsonNumberSpan span;
+};
+
+
+/**
+ * Tag to parse a mutable buffer in situ: decoded strings are written back over their source bytes
+ * (a decoded string is never longer than its escaped form), so every string is a view of the buffer.
+ * @note The source text of escaped strings is destroyed.
+ */
+struct InSitu {
+  explicit InSitu() = default;
+};
+inline constexpr InSitu inSitu{};
+
+/**
+ * Collects the value of a string (or identifier) from its tokens.
+ * Unescaped characters are only tracked as a span of the source and copied in bulk when an escape breaks it,
+ * decoded escapes are encoded into a small staging area and appended together,
+ * so a string without escapes is returned as a view of the source.
+ */
+class StringAssembler {
+public:
+  /**
+   * start a string, its content begins at `offset` of `src`
+   * @param target `src.data()` to decode in situ, or `nullptr` to decode into the internal buffer
+   */
+  void start(std::u8string_view source, size_t offset, char8_t* target = nullptr) noexcept {
+    src = source;
+    runBegin = runEnd = first = written = offset;
+    staged = 0;
+    escaped = false;
+    this->target = target;
+  }
+  /** handle a token of the string, its character is `src[begin, end)` */
+  void feed(efjsonToken token, size_t begin, size_t end) {
+    switch(token.type) {
+    case efjsonType_STRING_NORMAL:
+#if EFJSON_CONF_EXTENDED_JSON
+    case efjsonType_IDENTIFIER_NORMAL:
+#endif
+      if(begin != runEnd) { /* broken by escapes */
+        flush();
+        runBegin = begin;
+      }
+      runEnd = end;
+      break;
+    case efjsonType_STRING_ESCAPE_START:
+#if EFJSON_CONF_EXTENDED_JSON
+    case efjsonType_IDENTIFIER_ESCAPE_START:
+#endif
+      if(!escaped) {
+        escaped = true;
+        buffer.clear();
+      }
+      break;
+    case efjsonType_STRING_ESCAPE:
+    case efjsonType_STRING_ESCAPE_UNICODE:
+#if EFJSON_CONF_EXTENDED_JSON
+    case efjsonType_STRING_ESCAPE_HEX:
+    case efjsonType_IDENTIFIER_ESCAPE:
+#endif
+      if(token.done) {
+        if(runEnd != runBegin || staged > sizeof(stage) - 4) flush();
+        staged += static_cast<size_t>(efjson_EncodeUtf8(stage + staged, token.extra));
+      }
+      break;
+    }
+  }
+  /**
+   * decode a run of `\\uXXXX` escapes at `offset` in bulk, instead of feeding them to `parser`
+   * @return the number of consumed bytes, 0 if there's no such escape
+   */
+  size_t unescape(StreamParserBase& parser, size_t offset) {
+    if(src.size() - offset < 6 || src[offset] != u8'\\' || src[offset + 1] != u8'u') return 0;
+    flush();
+    size_t consumed = 0;
+    for(;;) {
+      /* the output is at most half of the input */
+      size_t chunk = std::min(src.size() - offset - consumed, CHUNK), n, count;
+      std::u8string_view input = src.substr(offset + consumed, chunk);
+      if(target != nullptr) {
+        n = parser.unescapeUtf8(target + written, count, input);
+        written += count;
+      } else {
+        size_t size = buffer.size();
+        buffer.resize(size + chunk / 2);
+        n = parser.unescapeUtf8(buffer.data() + size, count, input);
+        buffer.resize(size + count);
+      }
+      consumed += n;
+      if(n == 0 || chunk - n >= 12) break; /* not stopped by the end of chunk */
+    }
+    runBegin = runEnd = offset + consumed;
+    return consumed;
+  }
+  /** the string, valid until the next `start()` unless it's a view of the source */
+  std::u8string_view finish() {
+    if(!escaped) return src.substr(runBegin, runEnd - runBegin);
+    flush();
+    if(target != nullptr) return std::u8string_view(target + first, written - first);
+    return buffer;
+  }
+
+private:
+  static constexpr size_t CHUNK = 6 * 64;
+
+  void flush() {
+    std::u8string_view run = src.substr(runBegin, runEnd - runBegin);
+    if(!escaped) {
+      escaped = true;
+      buffer.clear();
+    }
+    if(target != nullptr) {
+      /* only the consumed bytes are overwritten */
+      std::memmove(target + written, run.data(), run.size());
+      std::memcpy(target + written + run.size(), stage, staged);
+      written += run.size() + staged;
+    } else {
+      buffer.append(run);
+      buffer.append(reinterpret_cast<const char8_t*>(stage), staged);
+    }
+    runBegin = runEnd;
+    staged = 0;
+  }
+
+  std::u8string_view src;
+  char8_t* target = nullptr;
+  /** unescaped characters which haven't been copied */
+  size_t runBegin = 0, runEnd = 0;
+  /** start of the content, and end of the decoded part in situ */
+  size_t first = 0, written = 0;
+  /** encoded escapes which haven't been copied, they always follow the run */
+  efjsonUint8 stage[64];
+  size_t staged = 0;
+  bool escaped = false;
+  std::u8string buffer;
+};
+
+
+class LazyDocument;
+/**
+ * A handle to a value of `LazyDocument`.
+ * It's cheap to copy, and stays valid as long as the document is alive.
+ */
+class LazyValue {
+public:
+  class Iterator;
+
+  Category category() const noexcept;
+  bool isNull() const noexcept {
+    return category() == Category::Null;
+  }
+  /** number of elements (array) or members (object), 0 for other values */
+  size_t size() const noexcept;
+  /** the source text of the value */
+  std::u8string_view raw() const noexcept;
+  /** the key of the value, only valid for object members */
+  std::u8string_view key() const;
+
+  LazyValue operator[](size_t index) const;
+  LazyValue operator[](std::u8string_view key) const;
+  LazyValue operator[](std::string_view key) const {
+    return (*this)[std::u8string_view(reinterpret_cast<const char8_t*>(key.data()), key.size())];
+  }
+  std::optional<LazyValue> find(std::u8string_view key) const;
+  std::optional<LazyValue> find(std::string_view key) const {
+    return find(std::u8string_view(reinterpret_cast<const char8_t*>(key.data()), key.size()));
+  }
+
+  /** iterate elements (array) or member values (object) */
+  Iterator begin() const noexcept;
+  Iterator end() const noexcept;
+
+  /**
+   * Materialize the value.
+   * `T` can be `std::nullptr_t`, `bool`, integers, floating points, `std::u8string(_view)` and `std::string(_view)`.
+   * Strings are unescaped and numbers are converted here, not while the document is built.
+   * @note An escaped string is cached by the document, see the thread-safety note of `LazyDocument`.
+   */
+  template<class T>
+  T get() const;
+
+private:
+  friend class LazyDocument;
+  explicit LazyValue(const LazyDocument* doc, size_t index) noexcept : doc(doc), index(index) { }
+
+  const LazyDocument* doc;
+  size_t index;
+};
+
+/**
+ * On-demand document.
+ * Building it validates the input and records only the structure (value offsets and child counts),
+ * values are materialized when they are accessed.
+ * @note The document refers to `src` instead of copying it, so `src` must outlive the document.
+ *       In situ, escaped strings are decoded while building instead, and `raw()` of them is no longer meaningful.
+ * @note Reading is not thread-safe even through `const`: escaped strings are decoded into a cache of the document
+ *       on first access, so threads sharing a document must synchronize (or each build their own).
+ */
+class LazyDocument {
+public:
+  explicit LazyDocument(std::u8string_view src, efjsonUint32 option = 0) : src(src), option(option) {
+    build();
+  }
+  explicit LazyDocument(std::string_view src, efjsonUint32 option = 0)
+      : LazyDocument(std::u8string_view(reinterpret_cast<const char8_t*>(src.data()), src.size()), option) { }
+  /** strings are decoded in situ while the document is built, see `InSitu` */
+  LazyDocument(InSitu, std::span<char8_t> buffer, efjsonUint32 option = 0)
+      : src(buffer.data(), buffer.size()), option(option), target(buffer.data()) {
+    build();
+  }
+  LazyDocument(const LazyDocument& other) = delete;
+  LazyDocument& operator=(const LazyDocument& other) = delete;
+
+  LazyValue root() const {
+    if(nodes.empty()) throw JsonValueException{ "empty document" };
+    return LazyValue(this, 0);
+  }
+
+private:
+  friend class LazyValue;
+  friend class LazyValue::Iterator;
+
+  enum : uint8_t {
+    FlagEscaped = 0x1,
+    FlagIdentifier = 0x2,
+    FlagMember = 0x4,
+  };
+  struct Node {
+    size_t begin, end;
+    /** index of the node after the subtree */
+    size_t next;
+    /** number of elements or members, or the length of a string decoded in situ */
+    size_t size;
+    Category category;
+    uint8_t flag;
+  };
+  static constexpr size_t NONE = static_cast<size_t>(-1);
+
+  size_t open(std::vector<size_t>& stack, size_t begin, Category category, uint8_t flag, bool isKey) {
+    size_t index = nodes.size();
+    if(!isKey && !stack.empty()) {
+      Node& parent = nodes[stack.back()];
+      ++parent.size;
+      if(parent.category == Category::Object) flag |= FlagMember;
+    }
+    nodes.push_back(Node{ begin, begin, index + 1, 0, category, flag });
+    return index;
+  }
+  void build() {
+    StreamParser parser(option);
+    std::vector<size_t> stack;
+    efjsonUtf8Decoder decoder;
+    size_t begin = 0, literal = NONE, number = NONE, text = NONE;
+    efjsonUtf8Decoder_init(&decoder);
+    for(size_t i = 0;; ++i) {
+      efjsonUint32 u = 0;
+      if(i < src.size()) {
+        if(decoder.rest == 0) {
+          begin = i;
+          if(text != NONE && src[i] == u8'\\') {
+            if(size_t n = unescape(parser, i)) {
+              nodes[text].flag |= FlagEscaped;
+              i += n - 1;
+              continue;
+            }
+          }
+        }
+        switch(efjsonUtf8Decoder_feed(&decoder, &u, static_cast<efjsonUint8>(src[i]))) {
+        case -1:
+          throw JsonUnicodeException{ std::format("invalid UTF-8 character: 0x{:02X}", static_cast<uint8_t>(src[i])) };
+        case 0:
+          continue;
+        }
+      } else {
+        if(decoder.rest != 0) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+        begin = i;
+      }
+
+      efjsonToken token = parser.feedOneUnchecked(static_cast<char32_t>(u)).token;
+      if(number != NONE && (token.type >> efjson_TOKEN_CATEGORY_SHIFT) != efjsonCategory_NUMBER) {
+        nodes[number].end = begin;
+        number = NONE;
+      }
+      switch(token.type) {
+      case efjsonType_NULL:
+      case efjsonType_TRUE:
+      case efjsonType_FALSE:
+        if(token.index == 0)
+          literal = open(stack, begin, token.type == efjsonType_NULL ? Category::Null : Category::Boolean, 0, false);
+        if(token.done) nodes[literal].end = i + 1;
+        break;
+
+      case efjsonType_STRING_START:
+        text = open(stack, begin, Category::String, 0, parser.getLocation() == Location::Key);
+        if(target != nullptr) assembler.start(src, i + 1, target);
+        break;
+      case efjsonType_STRING_ESCAPE_START:
+#if EFJSON_CONF_EXTENDED_JSON
+      case efjsonType_STRING_NEXT_LINE:
+#endif
+        nodes[text].flag |= FlagEscaped;
+        break;
+      case efjsonType_STRING_END:
+        nodes[text].end = i + 1;
+        finishInSitu(text);
+        text = NONE;
+        break;
+
+#if EFJSON_CONF_EXTENDED_JSON
+      case efjsonType_IDENTIFIER_NORMAL:
+      case efjsonType_IDENTIFIER_ESCAPE_START:
+        if(text == NONE) {
+          text = open(stack, begin, Category::String, FlagIdentifier, true);
+          if(target != nullptr) assembler.start(src, begin, target);
+        }
+        if(token.type == efjsonType_IDENTIFIER_ESCAPE_START) nodes[text].flag |= FlagEscaped;
+        break;
+      case efjsonType_WHITESPACE:
+      case efjsonType_OBJECT_VALUE_START:
+        if(text != NONE) { /* end of identifier */
+          nodes[text].end = begin;
+          finishInSitu(text);
+          text = NONE;
+        }
+        break;
+#endif
+
+      case efjsonType_OBJECT_START:
+        stack.push_back(open(stack, begin, Category::Object, 0, false));
+        break;
+      case efjsonType_ARRAY_START:
+        stack.push_back(open(stack, begin, Category::Array, 0, false));
+        break;
+      case efjsonType_OBJECT_END:
+      case efjsonType_ARRAY_END: {
+        Node& node = nodes[stack.back()];
+        stack.pop_back();
+        node.end = i + 1;
+        node.next = nodes.size();
+      } break;
+
+      default:
+        if(number == NONE && (token.type >> efjson_TOKEN_CATEGORY_SHIFT) == efjsonCategory_NUMBER)
+          number = open(stack, begin, Category::Number, 0, false);
+      }
+      if(target != nullptr && text != NONE) assembler.feed(token, begin, i + 1);
+      if(u == 0) break;
+    }
+  }
+  /** validate (or decode in situ) a run of `\\uXXXX` escapes in bulk */
+  size_t unescape(StreamParser& parser, size_t offset) {
+    size_t count;
+    if(target != nullptr) return assembler.unescape(parser, offset);
+    return parser.unescapeUtf8(nullptr, count, src.substr(offset));
+  }
+  void finishInSitu(size_t index) {
+    if(target != nullptr && (nodes[index].flag & FlagEscaped)) nodes[index].size = assembler.finish().size();
+  }
+
+  std::u8string decode(const Node& node) const {
+    StreamParser parser(option);
+    efjsonUtf8Decoder decoder;
+    efjsonUint32 u;
+    size_t begin = node.begin;
+    efjsonUtf8Decoder_init(&decoder);
+    assembler.start(src, node.begin + 1);
+#if EFJSON_CONF_EXTENDED_JSON
+    if(node.flag & FlagIdentifier) {
+      parser.feedOneUnchecked(U'{');
+      assembler.start(src, node.begin);
+    }
+#endif
+    for(size_t i = node.begin; i < node.end; ++i) {
+      if(decoder.rest == 0) {
+        begin = i;
+        if(src[i] == u8'\\') {
+          if(size_t n = assembler.unescape(parser, i)) {
+            i += n - 1;
+            continue;
+          }
+        }
+      }
+      if(efjsonUtf8Decoder_feed(&decoder, &u, static_cast<efjsonUint8>(src[i])) != 1) continue;
+      assembler.feed(parser.feedOneUnchecked(static_cast<char32_t>(u)).token, begin, i + 1);
+    }
+    return std::u8string(assembler.finish());
+  }
+  std::u8string_view stringView(size_t index) const {
+    const Node& node = nodes[index];
+    if(node.category != Category::String) throw JsonValueException{ "value is not a string" };
+    if(!(node.flag & FlagEscaped)) {
+      if(node.flag & FlagIdentifier) return src.substr(node.begin, node.end - node.begin);
+      return src.substr(node.begin + 1, node.end - node.begin - 2);
+    }
+    if(target != nullptr) return src.substr(node.flag & FlagIdentifier ? node.begin : node.begin + 1, node.size);
+    auto iter = strings.find(index);
+    if(iter == strings.end()) iter = strings.emplace(index, decode(node)).first;
+    return iter->second;
+  }
+
+  std::u8string_view src;
+  efjsonUint32 option;
+  /** the mutable source in situ */
+  char8_t* target = nullptr;
+  std::vector<Node> nodes;
+  /** unescaped strings, materialized on access */
+  mutable std::unordered_map<size_t, std::u8string> strings;
+  mutable StringAssembler assembler;
+};
+
+class LazyValue::Iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = LazyValue;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = LazyValue;
+
+  Iterator() noexcept = default;
+  LazyValue operator*() const noexcept {
+    return LazyValue(doc, pos + offset);
+  }
+  Iterator& operator++() noexcept {
+    pos = doc->nodes[pos + offset].next;
+    return *this;
+  }
+  Iterator operator++(int) noexcept {
+    Iterator ret = *this;
+    ++*this;
+    return ret;
+  }
+  bool operator==(const Iterator& other) const noexcept {
+    return pos == other.pos;
+  }
+
+private:
+  friend class LazyValue;
+  explicit Iterator(const LazyDocument* doc, size_t pos, size_t offset) noexcept
+      : doc(doc), pos(pos), offset(offset) { }
+
+  const LazyDocument* doc = nullptr;
+  /** index of the element (array) or the key (object) */
+  size_t pos = 0;
+  size_t offset = 0;
+};
+
+inline Category LazyValue::category() const noexcept {
+  return doc->nodes[index].category;
+}
+inline size_t LazyValue::size() const noexcept {
+  const auto& node = doc->nodes[index];
+  return node.category == Category::String ? 0 : node.size;
+}
+inline std::u8string_view LazyValue::raw() const noexcept {
+  const auto& node = doc->nodes[index];
+  return doc->src.substr(node.begin, node.end - node.begin);
+}
+inline std::u8string_view LazyValue::key() const {
+  if(!(doc->nodes[index].flag & LazyDocument::FlagMember)) throw JsonValueException{ "value is not an object member" };
+  return doc->stringView(index - 1);
+}
+inline LazyValue::Iterator LazyValue::begin() const noexcept {
+  return Iterator(doc, index + 1, category() == Category::Object ? 1 : 0);
+}
+inline LazyValue::Iterator LazyValue::end() const noexcept {
+  return Iterator(doc, doc->nodes[index].next, category() == Category::Object ? 1 : 0);
+}
+inline LazyValue LazyValue::operator[](size_t i) const {
+  if(category() != Category::Array && category() != Category::Object)
+    throw JsonValueException{ "value is not an array or object" };
+  if(i >= size()) throw JsonValueException{ std::format("index {} out of range", i) };
+  auto iter = begin();
+  while(i--) ++iter;
+  return *iter;
+}
+inline std::optional<LazyValue> LazyValue::find(std::u8string_view key) const {
+  if(category() != Category::Object) throw JsonValueException{ "value is not an object" };
+  for(size_t pos = index + 1, end = doc->nodes[index].next; pos < end; pos = doc->nodes[pos + 1].next)
+    if(doc->stringView(pos) == key) return LazyValue(doc, pos + 1);
+  return std::nullopt;
+}
+inline LazyValue LazyValue::operator[](std::u8string_view key) const {
+  if(auto ret = find(key)) return *ret;
+  throw JsonValueException{ std::format("key \"{}\" not found", toString(key)) };
+}
+
+template<class T>
+T LazyValue::get() const {
+  if constexpr(std::is_same_v<T, std::nullptr_t>) {
+    if(category() != Category::Null) throw JsonValueException{ "value is not null" };
+    return nullptr;
+  } else if constexpr(std::is_same_v<T, bool>) {
+    if(category() != Category::Boolean) throw JsonValueException{ "value is not a boolean" };
+    return raw()[0] == u8't';
+  } else if constexpr(std::is_same_v<T, std::u8string_view> || std::is_same_v<T, std::u8string>) {
+    return T(doc->stringView(index));
+  } else if constexpr(std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>) {
+    auto str = doc->stringView(index);
+    return T(reinterpret_cast<const char*>(str.data()), str.size());
+  } else if constexpr(std::is_integral_v<T>) {
+    if(category() != Category::Number) throw JsonValueException{ "value is not a number" };
+    return toInteger<T>(raw());
+  } else if constexpr(std::is_floating_point_v<T>) {
+    if(category() != Category::Number) throw JsonValueException{ "value is not a number" };
+    return static_cast<T>(parseDouble(raw()));
+  } else {
+    static_assert(!sizeof(T), "unsupported type");
+  }
+}
+
+
+/** what `Cursor::scan` reports */
+enum class ScanEvent : uint8_t {
+  Key,
+  ObjectStart,
+  ObjectEnd,
+  ArrayStart,
+  ArrayEnd,
+  Null,
+  Boolean,
+  Number,
+  String,
 };
 
 
+/**
+ * Forward-only cursor over a UTF-8 buffer.
+ * It drives the stream parser directly and never builds a tree, values are read in document order:
+ * ```cpp
+ * efjson::Cursor cursor(src);
+ * cursor.enterObject();
+ * while(auto key = cursor.nextKey()) {
+ *   if(*key == u8"id") id = cursor.getInt64();
+ *   else cursor.skipValue();
+ * }
+ * ```
+ * @note Views returned by `nextKey()` and `getString()` refer to `src` or to an internal buffer,
+ *       they are only valid until the cursor moves on (or as long as the buffer in situ).
+ */
+class Cursor : protected StreamParser {
+public:
+  explicit Cursor(std::u8string_view src, efjsonUint32 option = 0) : StreamParser(option), src(src) { }
+  explicit Cursor(std::string_view src, efjsonUint32 option = 0)
+      : Cursor(std::u8string_view(reinterpret_cast<const char8_t*>(src.data()), src.size()), option) { }
+  /** strings are decoded in situ, so the views returned stay valid as long as `buffer`, see `InSitu` */
+  Cursor(InSitu, std::span<char8_t> buffer, efjsonUint32 option = 0)
+      : StreamParser(option), src(buffer.data(), buffer.size()), target(buffer.data()) { }
+
+  using StreamParserBase::getLine;
+  using StreamParserBase::getColumn;
+  using StreamParserBase::getPosition;
+  using StreamParserBase::getStage;
+  using StreamParserBase::setLimits;
+  /** byte offset of the next unread character */
+  size_t offset() const noexcept {
+    return pos;
+  }
+  /** whether skipped values are fully validated, otherwise only their brackets and quotes are checked */
+  void validateSkipped(bool enable) noexcept {
+    validating = enable;
+  }
+  /** start over on another buffer (not in situ), the option, the limits and `validateSkipped` are kept */
+  void reset(std::u8string_view source) noexcept {
+    StreamParser::reset();
+    src = source;
+    target = nullptr;
+    pos = begin = 0;
+    pending.reset();
+  }
+
+  /** category of the next value, without consuming it */
+  Category peek() {
+    efjsonToken token = nextValue();
+    pending = token;
+    return static_cast<Category>(token.type >> efjson_TOKEN_CATEGORY_SHIFT);
+  }
+
+  void enterObject() {
+    if(nextValue().type != efjsonType_OBJECT_START) throw JsonValueException{ "value is not an object" };
+  }
+  /** return the next key of the current object, or `std::nullopt` after the object is closed */
+  std::optional<std::u8string_view> nextKey() {
+    for(;;) {
+      efjsonToken token = nextSignificant();
+      switch(token.type) {
+      case efjsonType_OBJECT_NEXT:
+        continue;
+      case efjsonType_OBJECT_END:
+        return std::nullopt;
+      case efjsonType_STRING_START: {
+        std::u8string_view key = readString();
+        expectColon();
+        return key;
+      }
+#if EFJSON_CONF_EXTENDED_JSON
+      case efjsonType_IDENTIFIER_NORMAL:
+      case efjsonType_IDENTIFIER_ESCAPE_START:
+        return readIdentifier(token);
+#endif
+      default:
+        throw unexpected(token, "a key");
+      }
+    }
+  }
+  void enterArray() {
+    if(nextValue().type != efjsonType_ARRAY_START) throw JsonValueException{ "value is not an array" };
+  }
+  /** return whether there's another element in the current array, false after the array is closed */
+  bool nextElement() {
+    for(;;) {
+      efjsonToken token = nextSignificant();
+      switch(token.type) {
+      case efjsonType_ARRAY_NEXT:
+        continue;
+      case efjsonType_ARRAY_END:
+        return false;
+      default:
+        pending = token;
+        return true;
+      }
+    }
+  }
+
+  /**
+   * skip the next value, containers and strings are skipped without generating tokens
+   * @return the text of the value, it refers to `src`
+   */
+  std::u8string_view skipValue() {
+    efjsonToken token = nextValue();
+    size_t start = begin;
+    switch(token.type) {
+    case efjsonType_OBJECT_START:
+    case efjsonType_ARRAY_START:
+      skip(efjsonStreamParser_getDepth(&parser) - 1);
+      break;
+    case efjsonType_STRING_START:
+      skip(efjsonStreamParser_getDepth(&parser));
+      break;
+    case efjsonType_NULL:
+    case efjsonType_TRUE:
+    case efjsonType_FALSE:
+      readLiteral(token);
+      break;
+    default:
+      return readNumber();
+    }
+    return src.substr(start, pos - start);
+  }
+
+  void getNull() {
+    efjsonToken token = nextValue();
+    if(token.type != efjsonType_NULL) throw JsonValueException{ "value is not null" };
+    readLiteral(token);
+  }
+  bool getBool() {
+    efjsonToken token = nextValue();
+    if(token.type != efjsonType_TRUE && token.type != efjsonType_FALSE)
+      throw JsonValueException{ "value is not a boolean" };
+    readLiteral(token);
+    return token.type == efjsonType_TRUE;
+  }
+  int64_t getInt64() {
+    if((nextValue().type >> efjson_TOKEN_CATEGORY_SHIFT) != efjsonCategory_NUMBER)
+      throw JsonValueException{ "value is not a number" };
+    std::u8string_view text = readNumber();
+    if(auto value = StreamParser::getInt64()) return *value;
+    return toInteger<int64_t>(text); /* report the error */
+  }
+  double getDouble() {
+    if((nextValue().type >> efjson_TOKEN_CATEGORY_SHIFT) != efjsonCategory_NUMBER)
+      throw JsonValueException{ "value is not a number" };
+    std::u8string_view text = readNumber();
+    if(auto value = StreamParser::getDouble()) return *value;
+    return Number(text, getNumberSpan()).toDouble();
+  }
+  /** the number as it's written, e.g. for amounts that must not be rounded, it refers to `src` */
+  Number getNumber() {
+    if((nextValue().type >> efjson_TOKEN_CATEGORY_SHIFT) != efjsonCategory_NUMBER)
+      throw JsonValueException{ "value is not a number" };
+    std::u8string_view text = readNumber();
+    return Number(text, getNumberSpan());
+  }
+  std::u8string_view getString() {
+    if(nextValue().type != efjsonType_STRING_START) throw JsonValueException{ "value is not a string" };
+    return readString();
+  }
+  /**
+   * read the next value and report its shape only: keys, container boundaries and the kinds of the other values
+   * @param fn called as `fn(event, key)`, `key` is only set for `ScanEvent::Key`
+   * @note Strings are skipped like `skipValue()` and the digits of numbers are fed in bulk without conversion,
+   *       so only keys are decoded (and their views are valid during the call).
+   */
+  template<class Fn>
+  void scan(Fn&& fn) {
+    efjsonStackLength base = efjsonStreamParser_getDepth(&parser);
+    efjsonToken token = nextValue();
+    for(;;) {
+      switch(token.type) {
+      case efjsonType_OBJECT_START:
+        fn(ScanEvent::ObjectStart, std::u8string_view{});
+        break;
+      case efjsonType_ARRAY_START:
+        fn(ScanEvent::ArrayStart, std::u8string_view{});
+        break;
+      case efjsonType_STRING_START:
+        skip(efjsonStreamParser_getDepth(&parser));
+        fn(ScanEvent::String, std::u8string_view{});
+        break;
+      case efjsonType_NULL:
+      case efjsonType_TRUE:
+      case efjsonType_FALSE:
+        readLiteral(token);
+        fn(token.type == efjsonType_NULL ? ScanEvent::Null : ScanEvent::Boolean, std::u8string_view{});
+        break;
+      default:
+        readNumber();
+        fn(ScanEvent::Number, std::u8string_view{});
+      }
+      /* find the first token of the next value */
+      for(;;) {
+        efjsonStackLength depth = efjsonStreamParser_getDepth(&parser);
+        /* a number is ended by the next token, so a closing bracket after it has left the container already */
+        if(pending && (pending->type == efjsonType_OBJECT_END || pending->type == efjsonType_ARRAY_END)) ++depth;
+        if(depth == base) return;
+        token = nextSignificant();
+        if(token.type == efjsonType_OBJECT_NEXT || token.type == efjsonType_ARRAY_NEXT) continue;
+        if(token.type == efjsonType_OBJECT_END || token.type == efjsonType_ARRAY_END) {
+          fn(token.type == efjsonType_OBJECT_END ? ScanEvent::ObjectEnd : ScanEvent::ArrayEnd, std::u8string_view{});
+          continue;
+        }
+        if(getLocation() != Location::Key) break;
+#if EFJSON_CONF_EXTENDED_JSON
+        if(token.type != efjsonType_STRING_START) fn(ScanEvent::Key, readIdentifier(token));
+        else
+#endif
+        {
+          std::u8string_view key = readString();
+          expectColon();
+          fn(ScanEvent::Key, key);
+        }
+        token = nextValue();
+        break;
+      }
+    }
+  }
+  /** check that nothing but whitespace (and comments) follows the root value */
+  void end() {
+    efjsonToken token = nextSignificant();
+    if(token.type != efjsonType_EOF) throw unexpected(token, "the end of input");
+  }
+
+private:
+  /** feed the next character, `begin` is set to its offset */
+  efjsonToken next() {
+    efjsonUint32 u = 0;
+    begin = pos;
+    if(pos < src.size()) {
+      efjsonUtf8Decoder decoder;
+      efjsonUtf8Decoder_init(&decoder);
+      for(;;) {
+        char8_t c = src[pos++];
+        int ret = efjsonUtf8Decoder_feed(&decoder, &u, static_cast<efjsonUint8>(c));
+        if(ret == 1) break;
+        if(ret == -1)
+          throw JsonUnicodeException{ std::format("invalid UTF-8 character: 0x{:02X}", static_cast<uint8_t>(c)) };
+        if(pos == src.size()) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+      }
+    }
+    return feedOneUnchecked(static_cast<char32_t>(u)).token;
+  }
+  /** the next token which is not whitespace or comment */
+  efjsonToken nextSignificant() {
+    if(pending) {
+      efjsonToken token = *pending;
+      pending.reset();
+      return token;
+    }
+    for(;;) {
+      efjsonToken token = next();
+      switch(token.type >> efjson_TOKEN_CATEGORY_SHIFT) {
+      case efjsonCategory_WHITESPACE:
+#if EFJSON_CONF_EXTENDED_JSON
+      case efjsonCategory_COMMENT:
+#endif
+        continue;
+      }
+      return token;
+    }
+  }
+  /** the first token of the next value */
+  efjsonToken nextValue() {
+    efjsonToken token = nextSignificant();
+    switch(token.type >> efjson_TOKEN_CATEGORY_SHIFT) {
+    case efjsonCategory_NULL:
+    case efjsonCategory_BOOLEAN:
+    case efjsonCategory_NUMBER:
+      return token;
+    case efjsonCategory_STRING:
+    case efjsonCategory_OBJECT:
+    case efjsonCategory_ARRAY:
+      if(token.type == efjsonType_STRING_START || token.type == efjsonType_OBJECT_START
+         || token.type == efjsonType_ARRAY_START)
+        return token;
+    }
+    throw unexpected(token, "a value");
+  }
+  static JsonValueException unexpected(efjsonToken token, const char* expected) {
+    return JsonValueException{
+      std::format("expected {}, got {}", expected, stringify(static_cast<TokenType>(token.type)))
+    };
+  }
+
+  void expectColon() {
+    efjsonToken token = nextSignificant();
+    if(token.type != efjsonType_OBJECT_VALUE_START) throw unexpected(token, "':'");
+  }
+  void readLiteral(efjsonToken token) {
+    while(!token.done) token = next();
+  }
+  /** return the lexeme, the first token has been consumed */
+  std::u8string_view readNumber() {
+    size_t start = begin;
+    /* the run of plain number characters is fed in bulk, the rest (and the token after it) one by one */
+    constexpr size_t RUN = 64;
+    efjsonUint32 chars[RUN];
+    efjsonToken tokens[RUN];
+    for(size_t n = RUN; n == RUN;) {
+      for(n = 0; n < RUN && pos + n < src.size(); ++n) {
+        char8_t c = src[pos + n];
+        if((c < u8'0' || c > u8'9') && c != u8'.' && c != u8'e' && c != u8'E' && c != u8'+' && c != u8'-') break;
+        chars[n] = c;
+      }
+      if(n == 0) break;
+      efjsonPosition before = getPosition();
+      if(efjsonStreamParser_feed(&parser, tokens, chars, n) == 0) {
+        size_t index = getPosition() - before;
+        char32_t u = static_cast<char32_t>(chars[index]);
+        begin = pos + index;
+        pos += index + 1;
+        throw JsonStreamParserException(static_cast<Error>(tokens[0].extra), u, getPosition(), getLine(), getColumn());
+      }
+      pos += n;
+    }
+    for(;;) {
+      efjsonToken token = next();
+      if((token.type >> efjson_TOKEN_CATEGORY_SHIFT) != efjsonCategory_NUMBER) {
+        /* the number is ended by the next token, which may be significant */
+        switch(token.type >> efjson_TOKEN_CATEGORY_SHIFT) {
+        case efjsonCategory_OBJECT:
+        case efjsonCategory_ARRAY:
+        case efjsonCategory_EOF:
+          pending = token;
+        }
+        return src.substr(start, begin - start);
+      }
+    }
+  }
+  /** return the unescaped string, `STRING_START` has been consumed */
+  std::u8string_view readString() {
+    assembler.start(src, pos, target);
+    for(;;) {
+      if(pos < src.size() && src[pos] == u8'\\') pos += assembler.unescape(*this, pos);
+      efjsonToken token = next();
+      if(token.type == efjsonType_STRING_END) return assembler.finish();
+      assembler.feed(token, begin, pos);
+    }
+  }
+#if EFJSON_CONF_EXTENDED_JSON
+  /** return the unescaped identifier and consume the colon, `token` is its first token */
+  std::u8string_view readIdentifier(efjsonToken token) {
+    assembler.start(src, begin, target);
+    for(;; token = next()) {
+      switch(token.type) {
+      case efjsonType_IDENTIFIER_NORMAL:
+      case efjsonType_IDENTIFIER_ESCAPE_START:
+      case efjsonType_IDENTIFIER_ESCAPE:
+        assembler.feed(token, begin, pos);
+        break;
+      default: {
+        std::u8string_view key = assembler.finish();
+        if(token.type != efjsonType_OBJECT_VALUE_START) expectColon();
+        return key;
+      }
+      }
+    }
+  }
+#endif
+  /** skip until the depth is back to `depth` */
+  void skip(efjsonStackLength depth) {
+    efjsonToken token;
+    const efjsonUint8* rest = reinterpret_cast<const efjsonUint8*>(src.data()) + pos;
+    pos += validating ? efjsonStreamParser_skipValidUtf8(&parser, &token, depth, rest, src.size() - pos)
+                      : efjsonStreamParser_skipUtf8(&parser, &token, depth, rest, src.size() - pos);
+    if(token.type == efjsonType_ERROR && token.extra == efjsonError_INVALID_INPUT_UTF)
+      throw JsonUnicodeException{ std::format("invalid UTF-8 character: 0x{:02X}", static_cast<uint8_t>(src[pos])) };
+    if(token.type == efjsonType_ERROR)
+      throw JsonStreamParserException(
+        static_cast<Error>(token.extra), static_cast<char32_t>(src[pos]), getPosition(), getLine(), getColumn()
+      );
+    if(!token.done) next(); /* the input is exhausted, let the parser report the error */
+  }
+
+  std::u8string_view src;
+  /** the mutable source in situ */
+  char8_t* target = nullptr;
+  /** offset of the next character */
+  size_t pos = 0;
+  /** offset of the last fed character */
+  size_t begin = 0;
+  /** a token which has been fed but not handled */
+  std::optional<efjsonToken> pending;
+  StringAssembler assembler;
+  bool validating = false;
+};
+
+/**
+ * Extracts the values selected by a set of JSON Pointers (RFC 6901) in one pass.
+ * The pointers are compiled into a trie, the input is read by a `Cursor` along the trie,
+ * subtrees that no pointer goes through are skipped without generating tokens,
+ * and reading stops once every pointer has been matched.
+ * ```cpp
+ * efjson::Projection projection{ u8"/user/id", u8"/entities/urls/0/url" };
+ * projection.run(src, [](size_t i, std::u8string_view value) { std::cout << i << ": " << value << '\n'; });
+ * ```
+ * A reference token is an array index in arrays (`-` matches nothing) and a key in objects.
+ * @note The input after the last match is not checked, call `Cursor::end()` on your own when it matters.
+ */
+class Projection {
+public:
+  Projection(std::initializer_list<std::u8string_view> pointers) {
+    for(auto pointer: pointers) add(pointer);
+  }
+  template<class Range>
+    requires std::convertible_to<std::ranges::range_value_t<Range>, std::u8string_view>
+  explicit Projection(const Range& pointers) {
+    for(auto&& pointer: pointers) add(std::u8string_view(pointer));
+  }
+
+  /** number of pointers */
+  size_t size() const noexcept {
+    return count;
+  }
+  /**
+   * read `src` and call `fn(i, value)` for the value of the `i`-th pointer, `value` is its text in `src`
+   * @return the number of matched pointers
+   */
+  template<class Fn>
+  size_t run(std::u8string_view src, Fn&& fn, efjsonUint32 option = 0) const {
+    Cursor cursor(src, option);
+    std::vector<size_t> pending(nodes.size());
+    for(size_t i = nodes.size(); i-- > 0;) {
+      pending[i] += nodes[i].targets.size();
+      if(i != 0) pending[nodes[i].parent] += pending[i];
+    }
+    walk(cursor, src, 0, pending, fn);
+    if(pending[0] != 0) cursor.end(); /* the whole input has been read */
+    return count - pending[0];
+  }
+  template<class Fn>
+  size_t run(std::string_view src, Fn&& fn, efjsonUint32 option = 0) const {
+    return run(std::u8string_view(reinterpret_cast<const char8_t*>(src.data()), src.size()), fn, option);
+  }
+
+private:
+  struct Node {
+    /** the reference token leading to this node */
+    std::u8string key;
+    /** `key` as an array index, `NO_INDEX` if it's not one */
+    size_t index;
+    size_t parent;
+    std::vector<size_t> children;
+    /** pointers ending at this node */
+    std::vector<size_t> targets;
+  };
+  static constexpr size_t NO_INDEX = static_cast<size_t>(-1);
+
+  void add(std::u8string_view pointer) {
+    if(!pointer.empty() && pointer[0] != u8'/') throw JsonValueException{ "JSON pointer must start with '/'" };
+    size_t node = 0;
+    while(!pointer.empty()) {
+      pointer.remove_prefix(1);
+      size_t end = std::min(pointer.find(u8'/'), pointer.size());
+      std::u8string key;
+      for(size_t i = 0; i < end; ++i) {
+        if(pointer[i] != u8'~') key += pointer[i];
+        else if(i + 1 < end && (pointer[i + 1] == u8'0' || pointer[i + 1] == u8'1'))
+          key += pointer[++i] == u8'0' ? u8'~' : u8'/';
+        else throw JsonValueException{ "bad escape in JSON pointer" };
+      }
+      pointer.remove_prefix(end);
+      node = child(node, std::move(key));
+    }
+    nodes[node].targets.push_back(count++);
+  }
+  size_t child(size_t node, std::u8string&& key) {
+    for(size_t i: nodes[node].children)
+      if(nodes[i].key == key) return i;
+    size_t index = NO_INDEX;
+    if(!key.empty() && key.size() < 20 && (key[0] != u8'0' || key.size() == 1)) {
+      index = 0;
+      for(char8_t c: key) {
+        if(c < u8'0' || c > u8'9') {
+          index = NO_INDEX;
+          break;
+        }
+        index = index * 10 + static_cast<size_t>(c - u8'0');
+      }
+    }
+    nodes.push_back(Node{ std::move(key), index, node, {}, {} });
+    nodes[node].children.push_back(nodes.size() - 1);
+    return nodes.size() - 1;
+  }
+
+  template<class Fn>
+  void walk(Cursor& cursor, std::u8string_view src, size_t node, std::vector<size_t>& pending, Fn& fn) const {
+    const Node& current = nodes[node];
+    std::u8string_view value;
+    size_t done = current.targets.size();
+    if(pending[node] == 0) { /* a duplicate key */
+      cursor.skipValue();
+      return;
+    } else if(pending[node] == done) {
+      value = cursor.skipValue();
+    } else {
+      Category category = cursor.peek();
+      size_t start = cursor.offset() - 1; /* brackets are single bytes */
+      if(category == Category::Object) {
+        cursor.enterObject();
+        while(auto key = cursor.nextKey()) {
+          auto it = std::ranges::find_if(current.children, [&](size_t i) { return nodes[i].key == *key; });
+          if(it == current.children.end()) cursor.skipValue();
+          else walk(cursor, src, *it, pending, fn);
+          if(pending[0] == 0) return;
+        }
+      } else if(category == Category::Array) {
+        cursor.enterArray();
+        for(size_t index = 0; cursor.nextElement(); ++index) {
+          auto it = std::ranges::find_if(current.children, [&](size_t i) { return nodes[i].index == index; });
+          if(it == current.children.end()) cursor.skipValue();
+          else walk(cursor, src, *it, pending, fn);
+          if(pending[0] == 0) return;
+        }
+      } else {
+        value = cursor.skipValue();
+        start = NO_INDEX;
+      }
+      if(start != NO_INDEX) value = src.substr(start, cursor.offset() - start);
+    }
+    for(size_t i: current.targets) fn(i, value);
+    for(size_t i = node;; i = nodes[i].parent) {
+      pending[i] -= done;
+      if(i == 0) break;
+    }
+  }
+
+  std::vector<Node> nodes{ Node{ {}, NO_INDEX, 0, {}, {} } };
+  size_t count = 0;
+};
+
+/**
+ * A subset of JSONPath, compiled once and evaluated over the input in one pass:
+ *   - `.name`, `['name']`, `.*`, `[*]`, `[0]`
+ *   - recursive descent, e.g. `..name`, `..*`, `..[0]`
+ *   - filters on members of the element, e.g. `[?(@.lang=='en')]`, `[?(@.user.id>=10)]`, `[?(@.id)]`
+ * ```cpp
+ * efjson::JsonPath path(u8"$.statuses[?(@.lang=='en')].user.screen_name");
+ * path.run(src, [](std::u8string_view value) { std::cout << value << '\n'; });
+ * ```
+ * The steps are the states of an automaton, the states active on a value are kept as a bit mask,
+ * and values on which no state is active are skipped without generating tokens.
+ * An element tested by a filter is tested by a second cursor from its first character, then read in place;
+ * a scalar is skipped first, since it only ends at the character after it.
+ *
+ * `run` doesn't modify the object, so a compiled path can be shared by threads.
+ */
+class JsonPath {
+public:
+  explicit JsonPath(std::u8string_view path) {
+    compile(path);
+  }
+  explicit JsonPath(std::string_view path)
+      : JsonPath(std::u8string_view(reinterpret_cast<const char8_t*>(path.data()), path.size())) { }
+
+  /**
+   * read `src` and call `fn(value)` for each matched value, `value` is its text in `src`
+   * @return the number of matched values
+   * @note A container is reported after the values matched inside it.
+   */
+  template<class Fn>
+  size_t run(std::u8string_view src, Fn&& fn, efjsonUint32 option = 0) const {
+    Cursor cursor(src, option), scratch(src, option);
+    size_t matched = 0;
+    walk(cursor, src, 1, fn, matched, scratch);
+    cursor.end();
+    return matched;
+  }
+  template<class Fn>
+  size_t run(std::string_view src, Fn&& fn, efjsonUint32 option = 0) const {
+    return run(std::u8string_view(reinterpret_cast<const char8_t*>(src.data()), src.size()), fn, option);
+  }
+
+private:
+  enum class Selector : uint8_t { Name, Index, Wildcard, Filter };
+  enum class Compare : uint8_t { Exists, Eq, Ne, Lt, Le, Gt, Ge };
+  struct Step {
+    Selector selector;
+    /** whether the selector applies to all descendants instead of children */
+    bool descendant;
+    /** the key for `Name`, the literal (if it's a string) for `Filter` */
+    std::u8string name;
+    size_t index;
+    /** members leading to the tested value of `Filter` */
+    std::vector<std::u8string> members;
+    Compare compare;
+    Category category;
+    double number;
+  };
+  /** the state `steps.size()` accepts, and it must fit in the mask */
+  static constexpr size_t MAX_STEPS = 63;
+
+  [[noreturn]] static void fail(const char* what) {
+    throw JsonValueException{ std::format("bad JSONPath: {}", what) };
+  }
+  static bool isNameChar(char8_t c) noexcept {
+    char8_t lower = static_cast<char8_t>(c | 0x20);
+    return c >= 0x80 || c == u8'_' || c == u8'$' || (c >= u8'0' && c <= u8'9') || (lower >= u8'a' && lower <= u8'z');
+  }
+  static void skipSpace(std::u8string_view path, size_t& i) noexcept {
+    while(i < path.size() && (path[i] == u8' ' || path[i] == u8'\t')) ++i;
+  }
+  static std::u8string readName(std::u8string_view path, size_t& i) {
+    size_t start = i;
+    while(i < path.size() && isNameChar(path[i])) ++i;
+    if(i == start) fail("expected a name");
+    return std::u8string(path.substr(start, i - start));
+  }
+  static std::u8string readQuoted(std::u8string_view path, size_t& i) {
+    char8_t quote = path[i++];
+    std::u8string str;
+    for(;; ++i) {
+      if(i >= path.size()) fail("unclosed string");
+      if(path[i] == quote) break;
+      if(path[i] == u8'\\' && ++i >= path.size()) fail("unclosed string");
+      str += path[i];
+    }
+    ++i;
+    return str;
+  }
+  static size_t readIndex(std::u8string_view path, size_t& i) {
+    size_t index = 0, start = i;
+    for(; i < path.size() && path[i] >= u8'0' && path[i] <= u8'9'; ++i) {
+      if(index > (std::numeric_limits<size_t>::max() - 9) / 10) fail("index out of range");
+      index = index * 10 + static_cast<size_t>(path[i] - u8'0');
+    }
+    if(i == start) fail("expected an index");
+    return index;
+  }
+  static void readFilter(std::u8string_view path, size_t& i, Step& step) {
+    skipSpace(path, i);
+    if(i >= path.size() || path[i++] != u8'@') fail("filter must start with '@'");
+    while(i < path.size() && path[i] == u8'.') step.members.push_back(readName(path, ++i));
+    if(step.members.empty()) fail("filter must test a member");
+    skipSpace(path, i);
+    static constexpr std::pair<std::u8string_view, Compare> OPERATORS[] = {
+      { u8"==", Compare::Eq }, { u8"!=", Compare::Ne }, { u8"<=", Compare::Le },
+      { u8">=", Compare::Ge }, { u8"<", Compare::Lt },  { u8">", Compare::Gt },
+    };
+    step.compare = Compare::Exists;
+    for(auto& [text, compare]: OPERATORS)
+      if(path.substr(i).starts_with(text)) {
+        step.compare = compare;
+        i += text.size();
+        break;
+      }
+    if(step.compare == Compare::Exists) return;
+    skipSpace(path, i);
+    if(i >= path.size()) fail("expected a literal");
+    std::u8string_view rest = path.substr(i);
+    if(path[i] == u8'\'' || path[i] == u8'"') {
+      step.category = Category::String;
+      step.name = readQuoted(path, i);
+    } else if(rest.starts_with(u8"true") || rest.starts_with(u8"false")) {
+      step.category = Category::Boolean;
+      step.number = rest[0] == u8't';
+      i += rest[0] == u8't' ? 4 : 5;
+    } else if(rest.starts_with(u8"null")) {
+      step.category = Category::Null;
+      i += 4;
+    } else {
+      size_t start = i;
+      while(i < path.size() && (isNameChar(path[i]) || path[i] == u8'.' || path[i] == u8'-' || path[i] == u8'+')) ++i;
+      step.category = Category::Number;
+      std::u8string_view text = path.substr(start, i - start);
+      auto [end, ec] = std::from_chars(
+        reinterpret_cast<const char*>(text.data()), reinterpret_cast<const char*>(text.data() + text.size()),
+        step.number
+      );
+      if(ec != std::errc{} || end != reinterpret_cast<const char*>(text.data() + text.size()))
+        fail("expected a literal");
+    }
+  }
+
+  void compile(std::u8string_view path) {
+    size_t i = 0;
+    skipSpace(path, i);
+    if(i >= path.size() || path[i++] != u8'$') fail("must start with '$'");
+    while(skipSpace(path, i), i < path.size()) {
+      Step step{ Selector::Wildcard, false, {}, 0, {}, Compare::Exists, Category::Null, 0 };
+      bool dot = path[i] == u8'.';
+      if(path.substr(i).starts_with(u8"..")) {
+        step.descendant = true;
+        i += 2;
+      } else if(dot) ++i;
+      else if(path[i] != u8'[') fail("unexpected character");
+      if(i < path.size() && path[i] == u8'[' && (step.descendant || !dot)) {
+        skipSpace(path, ++i);
+        if(i >= path.size()) fail("unclosed bracket");
+        if(path[i] == u8'*') ++i;
+        else if(path[i] == u8'\'' || path[i] == u8'"') {
+          step.selector = Selector::Name;
+          step.name = readQuoted(path, i);
+        } else if(path[i] == u8'?') {
+          step.selector = Selector::Filter;
+          skipSpace(path, ++i);
+          bool paren = i < path.size() && path[i] == u8'(';
+          if(paren) ++i;
+          readFilter(path, i, step);
+          skipSpace(path, i);
+          if(paren && (i >= path.size() || path[i++] != u8')')) fail("expected ')'");
+        } else {
+          step.selector = Selector::Index;
+          step.index = readIndex(path, i);
+        }
+        skipSpace(path, i);
+        if(i >= path.size() || path[i++] != u8']') fail("expected ']'");
+      } else if(i < path.size() && path[i] == u8'*') ++i;
+      else {
+        step.selector = Selector::Name;
+        step.name = readName(path, i);
+      }
+      if(steps.size() == MAX_STEPS) fail("too many steps");
+      steps.push_back(std::move(step));
+    }
+  }
+
+  /** states of a child from the states `mask` of its parent, filters are left to `test` */
+  uint64_t transit(uint64_t mask, const std::u8string_view* key, size_t index) const noexcept {
+    uint64_t result = 0;
+    for(; mask != 0; mask &= mask - 1) {
+      size_t i = static_cast<size_t>(std::countr_zero(mask));
+      const Step& step = steps[i];
+      if(step.descendant) result |= uint64_t(1) << i;
+      switch(step.selector) {
+      case Selector::Name:
+        if(key != nullptr && *key == step.name) result |= uint64_t(2) << i;
+        break;
+      case Selector::Index:
+        if(key == nullptr && index == step.index) result |= uint64_t(2) << i;
+        break;
+      case Selector::Wildcard:
+        result |= uint64_t(2) << i;
+        break;
+      case Selector::Filter:
+        break;
+      }
+    }
+    return result;
+  }
+  /** `cursor` is at the tested value */
+  bool test(const Step& step, Cursor& cursor) const {
+    for(auto& member: step.members) {
+      if(cursor.peek() != Category::Object) return step.compare == Compare::Ne;
+      cursor.enterObject();
+      for(;;) {
+        auto key = cursor.nextKey();
+        if(!key) return step.compare == Compare::Ne;
+        if(*key == member) break;
+        cursor.skipValue();
+      }
+    }
+    if(step.compare == Compare::Exists) return true;
+    Category category = cursor.peek();
+    if(category != step.category) return step.compare == Compare::Ne;
+    int order = 0;
+    if(category == Category::String) {
+      std::u8string_view str = cursor.getString();
+      order = str < step.name ? -1 : str > step.name ? 1 : 0;
+    } else if(category == Category::Number || category == Category::Boolean) {
+      double number = category == Category::Number ? cursor.getDouble() : cursor.getBool();
+      if(number != number) return step.compare == Compare::Ne; /* NaN */
+      order = number < step.number ? -1 : number > step.number ? 1 : 0;
+    } else if(category != Category::Null) return step.compare == Compare::Ne;
+    switch(step.compare) {
+    case Compare::Eq:
+      return order == 0;
+    case Compare::Ne:
+      return order != 0;
+    case Compare::Lt:
+      return order < 0;
+    case Compare::Le:
+      return order <= 0;
+    case Compare::Gt:
+      return order > 0;
+    default:
+      return order >= 0;
+    }
+  }
+  /** states of a child, `cursor` is at the child, `scratch` is the cursor for filters */
+  template<class Fn>
+  void child(
+    Cursor& cursor, std::u8string_view src, uint64_t mask, const std::u8string_view* key, size_t index, Fn& fn,
+    size_t& matched, Cursor& scratch
+  ) const {
+    uint64_t next = transit(mask, key, index);
+    uint64_t filters = 0;
+    for(uint64_t rest = mask; rest != 0; rest &= rest - 1)
+      if(steps[static_cast<size_t>(std::countr_zero(rest))].selector == Selector::Filter) filters |= rest & -rest;
+    if(filters == 0) {
+      if(next == 0) cursor.skipValue();
+      else walk(cursor, src, next, fn, matched, scratch);
+      return;
+    }
+    Category category = cursor.peek();
+    bool container = category == Category::Object || category == Category::Array;
+    /* a container is tested up to its closing bracket, so the rest of `src` doesn't matter */
+    std::u8string_view value = container ? src.substr(cursor.offset() - 1) : cursor.skipValue();
+    for(; filters != 0; filters &= filters - 1) {
+      size_t i = static_cast<size_t>(std::countr_zero(filters));
+      scratch.reset(value);
+      if(test(steps[i], scratch)) next |= uint64_t(2) << i;
+    }
+    if(container) {
+      if(next == 0) cursor.skipValue();
+      else walk(cursor, src, next, fn, matched, scratch);
+    } else if(next & (uint64_t(1) << steps.size())) {
+      ++matched;
+      fn(value);
+    }
+  }
+  /** read a value with the states `mask` */
+  template<class Fn>
+  void walk(Cursor& cursor, std::u8string_view src, uint64_t mask, Fn& fn, size_t& matched, Cursor& scratch) const {
+    uint64_t accept = uint64_t(1) << steps.size();
+    std::u8string_view value;
+    if((mask & ~accept) == 0) value = cursor.skipValue();
+    else {
+      Category category = cursor.peek();
+      size_t start = cursor.offset() - 1; /* brackets are single bytes */
+      if(category == Category::Object) {
+        cursor.enterObject();
+        while(auto key = cursor.nextKey()) child(cursor, src, mask & ~accept, &*key, 0, fn, matched, scratch);
+      } else if(category == Category::Array) {
+        cursor.enterArray();
+        for(size_t index = 0; cursor.nextElement(); ++index)
+          child(cursor, src, mask & ~accept, nullptr, index, fn, matched, scratch);
+      } else {
+        value = cursor.skipValue();
+        start = static_cast<size_t>(-1);
+      }
+      if(start != static_cast<size_t>(-1)) value = src.substr(start, cursor.offset() - start);
+    }
+    if(mask & accept) {
+      ++matched;
+      fn(value);
+    }
+  }
+
+  std::vector<Step> steps;
+};
+
+
+/**
+ * Read-only view of the whole content of a file.
+ * Regular files are mapped with `mmap` (with sequential and huge page hints), so even multi-GB files are parsed
+ * without being copied into user space; pipes and other files which can't be mapped are read whole into a buffer,
+ * as a `Cursor` needs all of the input (the token handler overload of `parseFile` streams them instead).
+ */
+class MappedFile {
+public:
+  static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+  explicit MappedFile(const std::filesystem::path& path) {
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd < 0) throw std::system_error(errno, std::generic_category(), path.string());
+    if(auto file = map(fd)) {
+      ::close(fd);
+      *this = std::move(*file);
+      return;
+    }
+    /* not mappable (e.g. a pipe), read it in chunks */
+    for(;;) {
+      if(buffer.size() - size < CHUNK_SIZE) buffer.resize(std::max(buffer.size() * 2, size + CHUNK_SIZE));
+      ssize_t n = ::read(fd, buffer.data() + size, CHUNK_SIZE);
+      if(n > 0) size += static_cast<size_t>(n);
+      else if(n == 0) break;
+      else if(errno != EINTR) {
+        int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), path.string());
+      }
+    }
+    ::close(fd);
+#else
+    std::FILE* file = std::fopen(path.string().c_str(), "rb");
+    if(!file) throw std::system_error(errno, std::generic_category(), path.string());
+    for(size_t n; (buffer.resize(size + CHUNK_SIZE), n = std::fread(buffer.data() + size, 1, CHUNK_SIZE, file)) != 0;)
+      size += n;
+    std::fclose(file);
+#endif
+  }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other) noexcept
+      : mapped(std::exchange(other.mapped, nullptr)), size(std::exchange(other.size, 0)),
+        buffer(std::move(other.buffer)) { }
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&& other) noexcept {
+    if(this != &other) {
+      release();
+      mapped = std::exchange(other.mapped, nullptr);
+      size = std::exchange(other.size, 0);
+      buffer = std::move(other.buffer);
+    }
+    return *this;
+  }
+  ~MappedFile() noexcept {
+    release();
+  }
+
+#if defined(__unix__) || defined(__APPLE__)
+  /**
+   * map the regular file `fd`, which is not closed
+   * @return `std::nullopt` if it can't be mapped, e.g. it's a pipe
+   */
+  static std::optional<MappedFile> map(int fd) {
+    struct stat st;
+    if(::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) return std::nullopt;
+    void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if(p == MAP_FAILED) return std::nullopt;
+    ::madvise(p, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+    ::madvise(p, static_cast<size_t>(st.st_size), MADV_HUGEPAGE);
+#endif
+    MappedFile file;
+    file.mapped = static_cast<char8_t*>(p);
+    file.size = static_cast<size_t>(st.st_size);
+    return file;
+  }
+#endif
+
+  std::u8string_view view() const noexcept {
+    return std::u8string_view(mapped ? mapped : buffer.data(), size);
+  }
+  /** whether the content is mapped rather than read into a buffer */
+  bool isMapped() const noexcept {
+    return mapped != nullptr;
+  }
+
+private:
+  MappedFile() noexcept = default;
+
+  void release() noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+    if(mapped) ::munmap(mapped, size);
+#endif
+    mapped = nullptr;
+  }
+
+  char8_t* mapped = nullptr;
+  size_t size = 0;
+  std::vector<char8_t> buffer;
+};
+
+/**
+ * Drives a `StreamParser` from a file descriptor or a `std::istream` a chunk at a time,
+ * so unbounded inputs such as pipes are parsed in constant memory.
+ * Each chunk is decoded into one buffer and fed in bulk, a UTF-8 sequence straddling two chunks is carried over
+ * by the decoder state instead of being copied.
+ * ```cpp
+ * efjson::ChunkReader reader(std::cin);
+ * reader.run([](const efjson::Token& token) { ... });
+ * ```
+ */
+class ChunkReader : protected StreamParser {
+public:
+  static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+#if defined(__unix__) || defined(__APPLE__)
+  /** `fd` is not closed */
+  explicit ChunkReader(int fd, efjsonUint32 option = 0) : StreamParser(option), fd(fd) {
+    efjsonUtf8Decoder_init(&decoder);
+  }
+#endif
+  explicit ChunkReader(std::istream& stream, efjsonUint32 option = 0) : StreamParser(option), stream(&stream) {
+    efjsonUtf8Decoder_init(&decoder);
+  }
+
+  using StreamParserBase::getLine;
+  using StreamParserBase::getColumn;
+  using StreamParserBase::getPosition;
+  using StreamParserBase::getStage;
+  using StreamParserBase::setLimits;
+  using StreamParser::getOffset;
+
+  /**
+   * read to the end of the input, `handler(token)` (or `handler(token, offset)`) is called for every token
+   * (ending with the EOF token)
+   */
+  template<TokenHandler Fn>
+  void run(Fn&& handler) {
+    while(step(handler)) { }
+  }
+  /**
+   * read and feed one chunk
+   * @return false once the end of the input is fed
+   */
+  template<TokenHandler Fn>
+  bool step(Fn&& handler) {
+    if(ended) return false;
+    if(!buffers) buffers = std::make_unique<Buffers>();
+    size_t n = read(buffers->bytes, CHUNK_SIZE), consumed;
+    if(n == 0) {
+      efjsonUint32 u;
+      if(efjsonUtf8Decoder_feed(&decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+      ended = true;
+      invokeTokenHandler(handler, end(), offset);
+      return false;
+    }
+    size_t count = efjsonUtf8Decoder_decode(
+      &decoder, buffers->chars, reinterpret_cast<const efjsonUint8*>(buffers->bytes), n, &consumed
+    );
+    feedDecoded(handler, buffers->tokens, buffers->chars, count, 1);
+    if(consumed != n) {
+      throw JsonUnicodeException{
+        std::format("invalid UTF-8 character: 0x{:02X}", static_cast<uint8_t>(buffers->bytes[consumed]))
+      };
+    }
+    return true;
+  }
+
+private:
+  struct Buffers {
+    alignas(64) char8_t bytes[CHUNK_SIZE];
+    efjsonUint32 chars[CHUNK_SIZE];
+    efjsonToken tokens[CHUNK_SIZE];
+  };
+
+  size_t read(char8_t* dest, size_t size) {
+    if(stream) {
+      stream->read(reinterpret_cast<char*>(dest), static_cast<std::streamsize>(size));
+      if(stream->bad()) throw std::system_error(std::make_error_code(std::io_errc::stream));
+      return static_cast<size_t>(stream->gcount());
+    }
+#if defined(__unix__) || defined(__APPLE__)
+    for(;;) {
+      ssize_t n = ::read(fd, dest, size);
+      if(n >= 0) return static_cast<size_t>(n);
+      if(errno != EINTR) throw std::system_error(errno, std::generic_category());
+    }
+#else
+    return 0;
+#endif
+  }
+
+  std::istream* stream = nullptr;
+  int fd = -1;
+  bool ended = false;
+  efjsonUtf8Decoder decoder;
+  std::unique_ptr<Buffers> buffers;
+};
+
+/**
+ * Parser reading from a byte ring it owns, so a reader (e.g. of a socket) writes straight into the parser's memory
+ * and the footprint per connection stays bounded.
+ * The producer writes into `writable()` and publishes the bytes with `commit(n)`; `parse(handler)` feeds
+ * the committed bytes and releases them at once, as tokens carry their characters and never point into the ring.
+ * `full()` asks the producer to wait for `parse`, and `needMore()` asks the consumer to wait for input.
+ * @note The producer and the consumer may run on two threads, but the waiting is up to the caller.
+ */
+class RingParser : protected StreamParser {
+public:
+  /** `capacity` is rounded up to a power of 2 */
+  explicit RingParser(size_t capacity = 64 * 1024, efjsonUint32 option = 0)
+      : StreamParser(option), mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+        ring(std::make_unique<char8_t[]>(mask + 1)) {
+    efjsonUtf8Decoder_init(&decoder);
+  }
+
+  using StreamParserBase::getLine;
+  using StreamParserBase::getColumn;
+  using StreamParserBase::getPosition;
+  using StreamParserBase::getStage;
+  using StreamParserBase::setLimits;
+  using StreamParser::getOffset;
+
+  size_t capacity() const noexcept {
+    return mask + 1;
+  }
+  /** the number of committed bytes not parsed yet */
+  size_t size() const noexcept {
+    return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+  }
+  bool full() const noexcept {
+    return size() == capacity();
+  }
+  bool needMore() const noexcept {
+    return size() == 0;
+  }
+
+  /**
+   * the free space the producer can write into, it may be shorter than `capacity() - size()` at the end of the ring
+   * (call again after `commit`), and it's empty if `full()`
+   */
+  std::span<char8_t> writable() noexcept {
+    size_t tail = this->tail.load(std::memory_order_relaxed), head = this->head.load(std::memory_order_acquire);
+    return { ring.get() + (tail & mask), std::min(capacity() - (tail - head), capacity() - (tail & mask)) };
+  }
+  /** publish `n` bytes written at the front of `writable()` */
+  void commit(size_t n) noexcept {
+    tail.store(tail.load(std::memory_order_relaxed) + n, std::memory_order_release);
+  }
+
+  /**
+   * parse at most `budget` committed bytes, `handler(token)` (or `handler(token, offset)`) is called for every
+   * token; a sequence cut at the end of the committed bytes waits for the next call
+   * @return the number of released bytes
+   */
+  template<TokenHandler Fn>
+  size_t parse(Fn&& handler, size_t budget = SIZE_MAX) {
+    size_t released = 0;
+    while(released < budget) {
+      size_t head = this->head.load(std::memory_order_relaxed), tail = this->tail.load(std::memory_order_acquire);
+      size_t n = std::min({ tail - head, capacity() - (head & mask), budget - released });
+      if(n == 0) break;
+      feedChunk(decoder, std::span<const char8_t>(ring.get() + (head & mask), n), handler);
+      this->head.store(head + n, std::memory_order_release);
+      released += n;
+    }
+    return released;
+  }
+  /** parse the rest and end the input, the last call to `handler` passes the EOF token */
+  template<TokenHandler Fn>
+  void end(Fn&& handler) {
+    efjsonUint32 u;
+    parse(handler);
+    if(efjsonUtf8Decoder_feed(&decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+    invokeTokenHandler(handler, StreamParser::end(), offset);
+  }
+
+private:
+  size_t mask;
+  std::unique_ptr<char8_t[]> ring;
+  alignas(64) std::atomic<size_t> head{ 0 };
+  alignas(64) std::atomic<size_t> tail{ 0 };
+  efjsonUtf8Decoder decoder;
+};
+
+/**
+ * Coroutine of `parseAsync`, it starts at once and runs until it awaits the source.
+ * It can be awaited by another coroutine, or polled with `done()` and `get()` by an event loop.
+ */
+class ParseTask {
+public:
+  struct promise_type {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+
+    ParseTask get_return_object() noexcept {
+      return ParseTask(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_never initial_suspend() noexcept {
+      return {};
+    }
+    auto final_suspend() noexcept {
+      struct Awaiter {
+        bool await_ready() noexcept {
+          return false;
+        }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+          auto continuation = handle.promise().continuation;
+          return continuation ? continuation : std::noop_coroutine();
+        }
+        void await_resume() noexcept { }
+      };
+      return Awaiter{};
+    }
+    void return_void() noexcept { }
+    void unhandled_exception() noexcept {
+      exception = std::current_exception();
+    }
+  };
+
+  ParseTask(ParseTask&& other) noexcept : handle(std::exchange(other.handle, nullptr)) { }
+  ParseTask& operator=(ParseTask&& other) noexcept {
+    if(this != &other) {
+      if(handle) handle.destroy();
+      handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+  }
+  ~ParseTask() noexcept {
+    if(handle) handle.destroy();
+  }
+
+  bool done() const noexcept {
+    return handle.done();
+  }
+  /** rethrow the exception the parse failed with, if any, the task must be done */
+  void get() const {
+    if(handle.promise().exception) std::rethrow_exception(handle.promise().exception);
+  }
+
+  bool await_ready() const noexcept {
+    return handle.done();
+  }
+  void await_suspend(std::coroutine_handle<> awaiting) noexcept {
+    handle.promise().continuation = awaiting;
+  }
+  void await_resume() const {
+    get();
+  }
+
+private:
+  explicit ParseTask(std::coroutine_handle<promise_type> handle) noexcept : handle(handle) { }
+
+  std::coroutine_handle<promise_type> handle;
+};
+
+/**
+ * Parse the UTF-8 text of `source` as chunks arrive, `handler(token)` is called for every token.
+ * `co_await source.read()` gives the next chunk (convertible to `std::span<const char8_t>`), and an empty one ends
+ * the input; the chunk only needs to stay valid until the next read.
+ * Many parses can then be interleaved on one thread, each suspended while its source has no data.
+ * @note `source` must outlive the task.
+ */
+template<class Source, TokenHandler Fn>
+ParseTask parseAsync(Source& source, Fn handler, efjsonUint32 option = 0) {
+  auto parser = std::make_unique<StreamParser>(option);
+  efjsonUtf8Decoder decoder;
+  efjsonUint32 u;
+  efjsonUtf8Decoder_init(&decoder);
+  for(;;) {
+    std::span<const char8_t> chunk = co_await source.read();
+    if(chunk.empty()) break;
+    parser->feedChunk(decoder, chunk, handler);
+  }
+  if(efjsonUtf8Decoder_feed(&decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+  invokeTokenHandler(handler, parser->end(), parser->getOffset());
+}
+
+/**
+ * Lock-free queue between one producer thread and one consumer thread.
+ * `push` never blocks, the producer must know there's room (e.g. it only passes back items it was given);
+ * `pop` waits until an item is available.
+ */
+template<class T, size_t N>
+class SpscQueue {
+  static_assert(N != 0 && (N & (N - 1)) == 0, "the capacity must be a power of 2");
+
+public:
+  void push(const T& item) noexcept {
+    size_t tail = this->tail.load(std::memory_order_relaxed);
+    items[tail & (N - 1)] = item;
+    this->tail.store(tail + 1, std::memory_order_release);
+    this->tail.notify_one();
+  }
+  T pop() noexcept {
+    size_t head = this->head.load(std::memory_order_relaxed), tail;
+    while((tail = this->tail.load(std::memory_order_acquire)) == head) this->tail.wait(tail, std::memory_order_acquire);
+    T item = items[head & (N - 1)];
+    this->head.store(head + 1, std::memory_order_release);
+    return item;
+  }
+
+private:
+  alignas(64) std::atomic<size_t> head{ 0 };
+  alignas(64) std::atomic<size_t> tail{ 0 };
+  T items[N];
+};
+
+/**
+ * Parses one large input on two threads: an I/O thread reads and decodes UTF-8 into chunks of codepoints,
+ * while the calling thread tokenizes them with `efjsonStreamParser_feed` and runs the handler,
+ * so decoding overlaps tokenizing. Chunks are passed by index through `SpscQueue`s, in both directions.
+ * The tokens and errors are the same as feeding the whole input at once.
+ */
+class PipelineParser : protected StreamParser {
+public:
+  static constexpr size_t CHUNK_SIZE = 16 * 1024;
+  static constexpr size_t CHUNKS = 8;
+
+  explicit PipelineParser(efjsonUint32 option = 0) noexcept : StreamParser(option) { }
+
+  using StreamParserBase::getLine;
+  using StreamParserBase::getColumn;
+  using StreamParserBase::getPosition;
+  using StreamParserBase::getStage;
+  using StreamParserBase::setLimits;
+  using StreamParser::getOffset;
+
+  /**
+   * parse the whole input, `read(dest, size)` is called on the I/O thread and returns the number of bytes read
+   * (0 at the end), `handler(token)` (or `handler(token, offset)`) is called on this thread for every token
+   * (ending with the EOF token)
+   * @note On failure, this waits for the pending `read` to return before throwing.
+   */
+  template<class Read, class Fn>
+    requires std::invocable<Read&, char8_t*, size_t> && TokenHandler<Fn>
+  void run(Read read, Fn&& handler) {
+    auto pipe = std::make_unique<Pipe>();
+    for(uint32_t i = 0; i < CHUNKS; ++i) pipe->free.push(i);
+    std::thread io([&pipe = *pipe, &read] { decode(pipe, read); });
+    try {
+      for(;;) {
+        Chunk chunk = pipe->ready.pop();
+        if(chunk.index == Chunk::END) break;
+        feedDecoded(handler, pipe->tokens, pipe->chars[chunk.index], chunk.count, 1);
+        pipe->free.push(chunk.index);
+      }
+      io.join();
+      if(pipe->error) std::rethrow_exception(pipe->error);
+      invokeTokenHandler(handler, end(), offset);
+    } catch(...) {
+      pipe->free.push(Chunk::END); /* there's always room, as only `CHUNKS` indices are in flight */
+      if(io.joinable()) io.join();
+      throw;
+    }
+  }
+  /** parse the whole content of `stream`, see `run` above */
+  template<TokenHandler Fn>
+  void run(std::istream& stream, Fn&& handler) {
+    run(
+      [&stream](char8_t* dest, size_t size) {
+        stream.read(reinterpret_cast<char*>(dest), static_cast<std::streamsize>(size));
+        if(stream.bad()) throw std::system_error(std::make_error_code(std::io_errc::stream));
+        return static_cast<size_t>(stream.gcount());
+      },
+      std::forward<Fn>(handler)
+    );
+  }
+
+private:
+  struct Chunk {
+    static constexpr uint32_t END = ~uint32_t(0);
+    uint32_t index, count;
+  };
+  struct Pipe {
+    SpscQueue<Chunk, CHUNKS * 2> ready;
+    SpscQueue<uint32_t, CHUNKS * 2> free;
+    std::exception_ptr error;
+    efjsonUint32 chars[CHUNKS][CHUNK_SIZE];
+    efjsonToken tokens[CHUNK_SIZE];
+  };
+
+  /* the I/O thread, each read of at most `CHUNK_SIZE` bytes fills one chunk */
+  template<class Read>
+  static void decode(Pipe& pipe, Read& read) {
+    char8_t bytes[CHUNK_SIZE];
+    efjsonUtf8Decoder decoder;
+    efjsonUint32 u;
+    efjsonUtf8Decoder_init(&decoder);
+    try {
+      for(;;) {
+        uint32_t index = pipe.free.pop();
+        if(index == Chunk::END) return;
+        size_t n = read(bytes, CHUNK_SIZE);
+        if(n == 0) break;
+        size_t consumed, count = efjsonUtf8Decoder_decode(
+          &decoder, pipe.chars[index], reinterpret_cast<const efjsonUint8*>(bytes), n, &consumed
+        );
+        pipe.ready.push(Chunk{ index, static_cast<uint32_t>(count) }); /* the characters before an invalid byte */
+        if(consumed != n) {
+          throw JsonUnicodeException{
+            std::format("invalid UTF-8 character: 0x{:02X}", static_cast<uint8_t>(bytes[consumed]))
+          };
+        }
+      }
+      if(efjsonUtf8Decoder_feed(&decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+    } catch(...) {
+      pipe.error = std::current_exception();
+    }
+    pipe.ready.push(Chunk{ Chunk::END, 0 });
+  }
+};
+
+#if defined(__linux__)
+/**
+ * Parses documents arriving on many non-blocking file descriptors (e.g. sockets) on one thread with `epoll`.
+ * Each ready descriptor is read once per `poll()` into a buffer shared by all of them, and its bytes are decoded and
+ * fed in bulk to the parser of that descriptor; every complete document (its text without the leading whitespace
+ * and comments) is passed to `onDocument`, and a descriptor can carry any number of documents one after another.
+ * A connection only keeps the bytes of its incomplete document.
+ *
+ * When a descriptor reaches its end, fails or its input is invalid, it's removed and `onClose(fd, error)` is called,
+ * `error` is null for a clean end; an exception thrown by `onDocument` also closes the descriptor.
+ * `setLimits` bounds what a peer can make the loop hold, exceeding them closes the descriptor as well.
+ * @note The descriptors are not closed by the loop. `onDocument` may `remove` (or `add`) descriptors.
+ */
+class EpollParserLoop {
+public:
+  static constexpr size_t READ_SIZE = 64 * 1024;
+  static constexpr int MAX_EVENTS = 64;
+  using DocumentHandler = std::function<void(int fd, std::u8string_view document)>;
+  using CloseHandler = std::function<void(int fd, std::exception_ptr error)>;
+
+  explicit EpollParserLoop(DocumentHandler onDocument, CloseHandler onClose = {}, efjsonUint32 option = 0)
+      : onDocument(std::move(onDocument)), onClose(std::move(onClose)), option(option), buffer(READ_SIZE) {
+    if((epoll = ::epoll_create1(EPOLL_CLOEXEC)) < 0) throw std::system_error(errno, std::generic_category());
+  }
+  EpollParserLoop(const EpollParserLoop&) = delete;
+  EpollParserLoop& operator=(const EpollParserLoop&) = delete;
+  ~EpollParserLoop() noexcept {
+    ::close(epoll);
+  }
+
+  /**
+   * limit the parser of every descriptor (see `efjsonLimits`, `maxInput` counts per document),
+   * and the bytes kept for an incomplete document, where 0 means unlimited
+   */
+  void setLimits(const efjsonLimits& limits, size_t maxPending = 0) noexcept {
+    this->limits = limits;
+    this->maxPending = maxPending;
+    for(auto& [fd, conn]: connections) conn->setLimits(limits);
+  }
+
+  /** register `fd` and make it non-blocking */
+  void add(int fd) {
+    int flags = ::fcntl(fd, F_GETFL);
+    if(flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+      throw std::system_error(errno, std::generic_category());
+    epoll_event event = {};
+    event.events = EPOLLIN | EPOLLRDHUP;
+    event.data.fd = fd;
+    if(::epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event) < 0) throw std::system_error(errno, std::generic_category());
+    connections[fd] = std::make_shared<Connection>(option);
+    connections[fd]->setLimits(limits);
+  }
+  /** unregister `fd` without calling `onClose`, its incomplete document is dropped */
+  void remove(int fd) noexcept {
+    ::epoll_ctl(epoll, EPOLL_CTL_DEL, fd, nullptr);
+    connections.erase(fd);
+  }
+  size_t size() const noexcept {
+    return connections.size();
+  }
+  /**
+   * wait up to `timeout` milliseconds (-1 for no limit) and handle every ready descriptor
+   * @return the number of handled descriptors
+   */
+  size_t poll(int timeout = -1) {
+    epoll_event events[MAX_EVENTS];
+    int n = ::epoll_wait(epoll, events, MAX_EVENTS, timeout);
+    if(n < 0) {
+      if(errno == EINTR) return 0;
+      throw std::system_error(errno, std::generic_category());
+    }
+    for(int i = 0; i < n; ++i) handle(events[i].data.fd);
+    return static_cast<size_t>(n);
+  }
+
+private:
+  static constexpr size_t BLOCK_SIZE = 1024;
+  struct Connection : StreamParser {
+    explicit Connection(efjsonUint32 option) : StreamParser(option) {
+      efjsonUtf8Decoder_init(&decoder);
+    }
+    /* feed `count` characters in bulk, @return the number of them fed before an error, which is put in `error` */
+    size_t feedUntilError(efjsonToken* tokens, const efjsonUint32* chars, size_t count, efjsonToken& error) {
+      efjsonPosition before = getPosition();
+      if(count == 0 || efjsonStreamParser_feed(&parser, tokens, chars, count) != 0) return count;
+      size_t index = getPosition() - before;
+      error = tokens[0];
+      tokens[0] = tokens[index]; /* the token of the first character, see `efjsonStreamParser_feed` */
+      return index;
+    }
+    using StreamParser::encodedSize;
+
+    efjsonUtf8Decoder decoder;
+    /* bytes from the start of the current document (or after the last one), up to `decoded` they've been fed */
+    std::u8string pending;
+    size_t begin = 0, decoded = 0, scan = 0, depth = 0;
+    /*
+     * whether the document has started, whether it's a number which ends at the next character,
+     * and whether a document has ended, so the parser only takes whitespace and comments until the next one
+     */
+    bool started = false, number = false, ended = false;
+  };
+
+  void handle(int fd) {
+    auto it = connections.find(fd);
+    if(it == connections.end()) return;
+    std::shared_ptr<Connection> owner = it->second; /* kept alive if `onDocument` removes it */
+    Connection& conn = *owner;
+    try {
+      ssize_t n = ::read(fd, buffer.data(), buffer.size());
+      if(n < 0) {
+        if(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return;
+        throw std::system_error(errno, std::generic_category());
+      }
+      if(n == 0) {
+        efjsonUint32 u;
+        if(efjsonUtf8Decoder_feed(&conn.decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+        if(conn.started || conn.ended) conn.end();
+        if(conn.number && !dispatch(fd, conn, conn.decoded)) return;
+        close(fd, nullptr);
+        return;
+      }
+      conn.pending.append(buffer.data(), static_cast<size_t>(n));
+      if(parse(fd, conn) && maxPending != 0 && conn.pending.size() > maxPending)
+        throw std::length_error("the incomplete document exceeds the pending limit");
+    } catch(...) {
+      if(registered(fd, conn)) close(fd, std::current_exception());
+    }
+  }
+  /* decode and feed the new bytes block by block, @return false if `onDocument` removed the connection */
+  bool parse(int fd, Connection& conn) {
+    efjsonToken tokens[BLOCK_SIZE];
+    efjsonUint32 chars[BLOCK_SIZE];
+    while(conn.scan < conn.pending.size()) {
+      size_t len = std::min(BLOCK_SIZE, conn.pending.size() - conn.scan), consumed;
+      const auto* bytes = reinterpret_cast<const efjsonUint8*>(conn.pending.data() + conn.scan);
+      size_t count = efjsonUtf8Decoder_decode(&conn.decoder, chars, bytes, len, &consumed);
+      conn.scan += consumed;
+      if(!feed(fd, conn, tokens, chars, count)) return false;
+      if(consumed != len) throw JsonUnicodeException{ "invalid UTF-8 sequence" };
+    }
+    /* only the incomplete document is kept */
+    size_t drop = conn.started ? conn.begin : conn.decoded;
+    conn.pending.erase(0, drop);
+    conn.begin -= conn.started ? drop : conn.begin;
+    conn.decoded -= drop;
+    conn.scan -= drop;
+    return true;
+  }
+  /* @return false if `onDocument` removed the connection */
+  bool feed(int fd, Connection& conn, efjsonToken* tokens, const efjsonUint32* chars, size_t count) {
+    for(size_t i = 0; i < count;) {
+      efjsonToken error;
+      size_t fed = conn.feedUntilError(tokens + i, chars + i, count - i, error);
+      for(size_t k = i; k < i + fed; ++k)
+        if(!step(fd, conn, tokens[k], chars[k])) return false;
+      if((i += fed) == count) break;
+      if(!conn.ended) {
+        throw JsonStreamParserException(
+          static_cast<Error>(error.extra), static_cast<char32_t>(chars[i]), conn.getPosition(), conn.getLine(),
+          conn.getColumn()
+        );
+      }
+      /* the next document starts, it's fed again to a new parser */
+      conn.reset();
+      conn.ended = false;
+    }
+    return true;
+  }
+  /* handle the token of the next character, @return false if `onDocument` removed the connection */
+  bool step(int fd, Connection& conn, efjsonToken token, efjsonUint32 u) {
+    size_t at = conn.decoded;
+    conn.decoded += Connection::encodedSize(u, 1);
+    efjsonUint8 category = static_cast<efjsonUint8>(token.type >> efjson_TOKEN_CATEGORY_SHIFT);
+    if(conn.number) {
+      if(category == efjsonCategory_NUMBER) return true;
+      if(!dispatch(fd, conn, at)) return false; /* it ends before this character */
+    }
+    if(conn.ended) return true;
+    if(!conn.started) {
+      if(category == efjsonCategory_WHITESPACE) return true;
+#if EFJSON_CONF_EXTENDED_JSON
+      if(category == efjsonCategory_COMMENT) return true;
+#endif
+      conn.started = true;
+      conn.begin = at;
+    }
+    switch(token.type) {
+    case efjsonType_ARRAY_START:
+    case efjsonType_OBJECT_START:
+      ++conn.depth;
+      return true;
+    case efjsonType_ARRAY_END:
+    case efjsonType_OBJECT_END:
+      return --conn.depth != 0 || dispatch(fd, conn, conn.decoded);
+    }
+    if(conn.depth != 0) return true;
+    switch(token.type) {
+    case efjsonType_STRING_END:
+      return dispatch(fd, conn, conn.decoded);
+    case efjsonType_NULL:
+    case efjsonType_TRUE:
+    case efjsonType_FALSE:
+#if EFJSON_CONF_EXTENDED_JSON
+    case efjsonType_NUMBER_NAN:
+    case efjsonType_NUMBER_INFINITY:
+#endif
+      return !token.done || dispatch(fd, conn, conn.decoded);
+    default:
+      if(category == efjsonCategory_NUMBER) conn.number = true;
+      return true;
+    }
+  }
+  /* @return false if `onDocument` removed the connection */
+  bool dispatch(int fd, Connection& conn, size_t end) {
+    std::u8string_view document(conn.pending.data() + conn.begin, end - conn.begin);
+    conn.begin = end;
+    conn.started = conn.number = false;
+    conn.ended = true;
+    onDocument(fd, document);
+    return registered(fd, conn);
+  }
+  bool registered(int fd, const Connection& conn) const noexcept {
+    auto it = connections.find(fd);
+    return it != connections.end() && it->second.get() == &conn;
+  }
+  void close(int fd, std::exception_ptr error) {
+    remove(fd);
+    if(onClose) onClose(fd, error);
+  }
+
+  DocumentHandler onDocument;
+  CloseHandler onClose;
+  efjsonUint32 option;
+  efjsonLimits limits = {};
+  size_t maxPending = 0;
+  int epoll;
+  std::vector<char8_t> buffer;
+  std::unordered_map<int, std::shared_ptr<Connection>> connections;
+};
+#endif
+
+/**
+ * Parse a file with a `Cursor` over its bytes (see `MappedFile`),
+ * `handler(cursor)` reads the document and the end of the input is checked after it returns.
+ * @return what `handler` returns, views into the file must not be returned as it's unmapped then
+ */
+template<class Fn>
+  requires std::invocable<Fn, Cursor&>
+decltype(auto) parseFile(const std::filesystem::path& path, Fn&& handler, efjsonUint32 option = 0) {
+  MappedFile file(path);
+  Cursor cursor(file.view(), option);
+  if constexpr(std::is_void_v<std::invoke_result_t<Fn, Cursor&>>) {
+    std::forward<Fn>(handler)(cursor);
+    cursor.end();
+  } else {
+    auto result = std::forward<Fn>(handler)(cursor);
+    cursor.end();
+    return result;
+  }
+}
+/**
+ * Parse a file in bulk, `handler(token)` (or `handler(token, offset)`) is called for every token
+ * (ending with the EOF token).
+ * A regular file is mapped (see `MappedFile`) and its bytes are fed by `StreamParser::feedChunk` without a copy,
+ * other files such as pipes are read by a `ChunkReader` in constant memory.
+ */
+template<TokenHandler Fn>
+  requires(!std::invocable<Fn, Cursor&>)
+void parseFile(const std::filesystem::path& path, Fn&& handler, efjsonUint32 option = 0) {
+#if defined(__unix__) || defined(__APPLE__)
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if(fd < 0) throw std::system_error(errno, std::generic_category(), path.string());
+  std::optional<MappedFile> file;
+  try {
+    if(!(file = MappedFile::map(fd))) ChunkReader(fd, option).run(handler);
+  } catch(...) {
+    ::close(fd);
+    throw;
+  }
+  ::close(fd);
+  if(!file) return;
+  StreamParser parser(option);
+  efjsonUtf8Decoder decoder;
+  efjsonUint32 u;
+  efjsonUtf8Decoder_init(&decoder);
+  parser.feedChunk(decoder, file->view(), handler);
+  if(efjsonUtf8Decoder_feed(&decoder, &u, 0) != 1) throw JsonUnicodeException{ "broken UTF-8 sequence" };
+  invokeTokenHandler(handler, parser.end(), parser.getOffset());
+#else
+  std::ifstream stream(path, std::ios::binary);
+  if(!stream) throw std::system_error(errno, std::generic_category(), path.string());
+  ChunkReader(stream, option).run(handler);
+#endif
+}
+
+
 }  // namespace efjson
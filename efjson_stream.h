@@ -80,6 +80,7 @@ int main(void) {
 #include <limits.h>
 #include <stddef.h>
 #include <assert.h>
+#include <float.h>
 
 
 #if UCHAR_MAX != 0xFF
@@ -99,6 +100,23 @@ typedef unsigned long efjsonUint32;
   #error "efjson.h: 32-bit integer not exists"
 #endif
 
+/* 64-bit integer is optional */
+#if ((ULONG_MAX >> 31) >> 31) == 3
+typedef unsigned long efjsonUint64;
+typedef long efjsonInt64;
+  #define EFJSON_INT64 1
+#elif defined(ULLONG_MAX) || defined(__LONG_LONG_MAX__)
+typedef unsigned long long efjsonUint64;
+typedef long long efjsonInt64;
+  #define EFJSON_INT64 1
+#elif defined(_MSC_VER)
+typedef unsigned __int64 efjsonUint64;
+typedef __int64 efjsonInt64;
+  #define EFJSON_INT64 1
+#else
+  #define EFJSON_INT64 0
+#endif
+
 typedef size_t efjsonPosition;
 typedef unsigned efjsonStackLength;
 
@@ -317,6 +335,32 @@ EFJSON_CODE_BEGIN
   #define EFJSON_CONF_CHECK_INPUT_UTF 1
 #endif
 
+/**
+ * Configuration: Whether to accumulate the value of numbers while parsing
+ * If enabled, `efjsonStreamParser_getInt64` and `efjsonStreamParser_getDouble` are provided.
+ * It requires a 64-bit integer type and IEEE 754 `double`.
+ */
+#ifndef EFJSON_CONF_NUMBER_VALUE
+  #if EFJSON_INT64 && DBL_MANT_DIG == 53 && DBL_MAX_EXP == 1024
+    #define EFJSON_CONF_NUMBER_VALUE 1
+  #else
+    #define EFJSON_CONF_NUMBER_VALUE 0
+  #endif
+#endif
+#if EFJSON_CONF_NUMBER_VALUE && !(EFJSON_INT64 && DBL_MANT_DIG == 53 && DBL_MAX_EXP == 1024)
+  #error "efjson.h: `EFJSON_CONF_NUMBER_VALUE` requires 64-bit integer and IEEE 754 double"
+#endif
+
+/**
+ * Configuration: Whether to record the layout of numbers while parsing
+ * If enabled, `efjsonStreamParser_getNumberSpan` is provided.
+ * Only the positions of the sign, '.', 'e' and the end are recorded, but the bookkeeping still slows down
+ * number-heavy input a little, so it's off by default (`efjson.hpp` enables it).
+ */
+#ifndef EFJSON_CONF_NUMBER_SPAN
+  #define EFJSON_CONF_NUMBER_SPAN 0
+#endif
+
 /**
  * Configuration: Whether to check the escaped Unicode codepoint is valid
  * This configuration only affects `string` and `identifier`.
@@ -325,6 +369,27 @@ EFJSON_CODE_BEGIN
   #define EFJSON_CONF_CHECK_ESCAPE_UTF 1
 #endif
 
+/**
+ * Configuration: Whether to scan the input with SSE2 where bytes are inspected in bulk
+ * Otherwise, a machine word is scanned at once by SWAR.
+ */
+#ifndef EFJSON_CONF_SIMD
+  #if !defined(UL_PEDANTIC) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define EFJSON_CONF_SIMD 1
+  #else
+    #define EFJSON_CONF_SIMD 0
+  #endif
+#endif
+
+/**
+ * Configuration: Whether to support resource limits set at runtime (see `efjsonStreamParser_setLimits`)
+ * A parser without limits only pays a flag test per character, but that's measurable on the plain
+ * `efjsonStreamParser_feedOne` path, so it's off by default (`efjson.hpp` enables it).
+ */
+#ifndef EFJSON_CONF_LIMITS
+  #define EFJSON_CONF_LIMITS 0
+#endif
+
 
 #ifndef EFJSON_PUBLIC
   #define EFJSON_PUBLIC
@@ -372,6 +437,15 @@ EFJSON_PUBLIC void efjsonUtf8Decoder_destroy(efjsonUtf8Decoder* decoder);
 EFJSON_PUBLIC void efjsonUtf8Decoder_init(efjsonUtf8Decoder* decoder);
 /** return number of decoded bytes (0/1 for normal, -1 for error) */
 EFJSON_PUBLIC int efjsonUtf8Decoder_feed(efjsonUtf8Decoder* decoder, efjsonUint32* result, efjsonUint8 c);
+/**
+ * Decode a run of bytes, like `efjsonUtf8Decoder_feed` on each of them.
+ * Blocks of 16 ASCII bytes are checked at once (see `EFJSON_CONF_SIMD`) and widened without the state machine.
+ * @param consumed set to the number of consumed bytes, it's less than `len` if `src[*consumed]` is invalid
+ * @return the number of codepoints written to `dest` (at most `len`)
+ */
+EFJSON_PUBLIC size_t efjsonUtf8Decoder_decode(
+  efjsonUtf8Decoder* decoder, efjsonUint32* dest, const efjsonUint8* src, size_t len, size_t* consumed
+);
 /** return number of encoded bytes (1-4 for normal, -1 for error) */
 EFJSON_PUBLIC int efjson_EncodeUtf8(efjsonUint8* p, efjsonUint32 u);
 
@@ -386,6 +460,38 @@ EFJSON_PUBLIC void efjsonUtf16Decoder_init(efjsonUtf16Decoder* decoder);
 EFJSON_PUBLIC int efjsonUtf16Decoder_feed(efjsonUtf16Decoder* decoder, efjsonUint32* result, efjsonUint16 c);
 /** return number of encoded bytes (1-2 for normal, -1 for error) */
 EFJSON_PUBLIC int efjson_EncodeUtf16(efjsonUint16* p, efjsonUint32 u);
+
+enum efjsonEncoding {
+  efjsonEncoding_UTF8 = 0,
+  efjsonEncoding_UTF16LE = 1,
+  efjsonEncoding_UTF16BE = 2,
+  efjsonEncoding_UTF32LE = 3,
+  efjsonEncoding_UTF32BE = 4
+};
+/**
+ * Detect the encoding of a document from its first bytes, by the BOM or else by the pattern of zero bytes
+ * (RFC 4627, section 3), UTF-8 is assumed if neither matches.
+ * @param bom set to the length of the BOM, which should be skipped
+ */
+EFJSON_PUBLIC enum efjsonEncoding efjson_detectEncoding(const efjsonUint8* src, size_t len, size_t* bom);
+/**
+ * Decode `len` UTF-16 code units (`2 * len` bytes) of the given byte order into codepoints,
+ * a surrogate pair cut at the end of `src` is carried over by `decoder`.
+ * Runs without surrogates are widened in bulk (see `EFJSON_CONF_SIMD`).
+ * @param consumed set to the number of consumed units, it's less than `len` if the unit at `*consumed` is invalid
+ * @return the number of codepoints written to `dest` (at most `len`)
+ */
+EFJSON_PUBLIC size_t efjson_decodeUtf16(
+  efjsonUtf16Decoder* decoder, efjsonUint32* dest, const efjsonUint8* src, size_t len, int bigEndian, size_t* consumed
+);
+/**
+ * Decode `len` UTF-32 code units (`4 * len` bytes) of the given byte order into codepoints.
+ * @param consumed set to the number of consumed units,
+ *   it's less than `len` at the first surrogate or value beyond U+10FFFF
+ * @return the number of codepoints written to `dest`, the same as `*consumed`
+ */
+EFJSON_PUBLIC size_t
+efjson_decodeUtf32(efjsonUint32* dest, const efjsonUint8* src, size_t len, int bigEndian, size_t* consumed);
 #endif
 
 
@@ -482,6 +588,12 @@ enum efjsonError /* efjsonUint8 */ {
   efjsonError_INVALID_INPUT_UTF,
   efjsonError_INVALID_ESCAPED_UTF,
   efjsonError_INCOMPLETE_SURROGATE_PAIR,
+  /* << limits >> */
+  efjsonError_TOO_DEEP,
+  efjsonError_STRING_TOO_LONG,
+  efjsonError_NUMBER_TOO_LONG,
+  efjsonError_TOO_MANY_VALUES,
+  efjsonError_INPUT_TOO_LONG,
   /* << other >> */
   efjsonError_EOF = 0x80,
   efjsonError_NONWHITESPACE_AFTER_END,
@@ -700,6 +812,44 @@ EFJSON_PUBLIC efjsonUint8 efjson_getError(efjsonToken token);
 #endif
 
 
+#if EFJSON_CONF_NUMBER_SPAN
+enum efjsonNumberFlag {
+  efjsonNumberFlag_NEGATIVE = 0x01,
+  efjsonNumberFlag_NEGATIVE_EXPONENT = 0x02,
+  efjsonNumberFlag_HEXADECIMAL = 0x04,
+  efjsonNumberFlag_OCTAL = 0x08,
+  efjsonNumberFlag_BINARY = 0x10,
+  efjsonNumberFlag_INFINITY = 0x20,
+  efjsonNumberFlag_NAN = 0x40
+};
+/**
+ * Layout of a number lexeme: `[sign][0x|0o|0b]integer[.fraction][e[sign]exponent]` (or `[sign]NaN`/`[sign]Infinity`).
+ * Offsets are relative to the first character, numbers are ASCII so they are byte offsets as well.
+ * Digit counts include leading zeros, every part may be empty.
+ */
+typedef struct efjsonNumberSpan {
+  efjsonPosition begin, length;
+  efjsonPosition integer, integerDigits;
+  efjsonPosition fraction, fractionDigits;
+  efjsonPosition exponent, exponentDigits;
+  efjsonUint8 /* efjsonNumberFlag_* */ flag;
+} efjsonNumberSpan;
+#endif /* EFJSON_CONF_NUMBER_SPAN */
+
+#if EFJSON_CONF_LIMITS
+/**
+ * Resource limits of a parser, 0 means unlimited.
+ * Lengths are counted in characters of the source text, so escapes are counted as written.
+ */
+typedef struct efjsonLimits {
+  efjsonPosition maxInput;        /* characters fed, `efjsonError_INPUT_TOO_LONG` */
+  efjsonPosition maxValues;       /* values and property names, `efjsonError_TOO_MANY_VALUES` */
+  efjsonPosition maxStringLength; /* between the quotes, or of an identifier, `efjsonError_STRING_TOO_LONG` */
+  efjsonPosition maxNumberLength; /* including the sign, `efjsonError_NUMBER_TOO_LONG` */
+  efjsonStackLength maxDepth;     /* nesting of arrays and objects, `efjsonError_TOO_DEEP` */
+} efjsonLimits;
+#endif /* EFJSON_CONF_LIMITS */
+
 typedef struct efjsonStreamParser {
   efjsonPosition position, line, column;
   efjsonUint32 option;
@@ -711,6 +861,22 @@ typedef struct efjsonStreamParser {
 #if EFJSON_CONF_COMBINE_ESCAPED_SURROGATE
   efjsonUint16 prevPair;
 #endif
+#if EFJSON_CONF_NUMBER_VALUE
+  efjsonUint8 digits, numberFlag;
+  /* value = mantissa * 10^(scale + exponent), or mantissa * 2^scale for hexadecimal/octal/binary */
+  efjsonUint64 mantissa;
+  long scale, exponent;
+#endif
+#if EFJSON_CONF_NUMBER_SPAN
+  /* positions of the first character, '.', 'e' and the character after the number */
+  efjsonPosition numberBegin, numberPoint, numberExponent, numberEnd;
+  efjsonUint16 spanFlag;
+#endif
+#if EFJSON_CONF_LIMITS
+  efjsonLimits limits;
+  /* the number of values so far, and the position of the first character of the last one */
+  efjsonPosition values, valueBegin;
+#endif
 
   efjsonStackLength len;
 #if EFJSON_CONF_FIXED_STACK > 0
@@ -729,15 +895,116 @@ EFJSON_PUBLIC void(efjsonStreamParser_deinit)(efjsonStreamParser* parser);
 EFJSON_PUBLIC int(efjsonStreamParser_initCopy)(efjsonStreamParser* parser, const efjsonStreamParser* src);
 EFJSON_PUBLIC void(efjsonStreamParser_initMove)(efjsonStreamParser* parser, efjsonStreamParser* src);
 EFJSON_PUBLIC efjsonStreamParser* efjsonStreamParser_newCopy(const efjsonStreamParser* src);
+#if EFJSON_CONF_LIMITS
+/**
+ * Set the resource limits, they're checked per character so a hostile input fails as soon as it exceeds one.
+ * `efjsonStreamParser_skipUtf8` checks only `maxInput` and `maxDepth`, as skipped content is never buffered.
+ * @note Limited parsers take the slow path for runs of digits and brackets.
+ */
+EFJSON_PUBLIC void efjsonStreamParser_setLimits(efjsonStreamParser* parser, const efjsonLimits* limits);
+#endif
 
 EFJSON_PUBLIC efjsonToken efjsonStreamParser_feedOne(efjsonStreamParser* parser, efjsonUint32 u);
 /**
  * Pass multiple UTF-32 codepoints to the parser.
  * @note If the string ends, remember to pass `EOF` to parser.
- * @return 0 if failed (and error will be writen to `dest[0]`), or the number of tokens if success.
+ * @return 0 if failed (and error will be writen to `dest[0]`, while the token of `src[0]` is moved to the slot of
+ *         the wrong character), or the number of tokens if success.
  */
 EFJSON_PUBLIC size_t
 efjsonStreamParser_feed(efjsonStreamParser* parser, efjsonToken* dest, const efjsonUint32* src, size_t len);
+/**
+ * Like `efjsonStreamParser_feed`, but `expired(opaque)` is asked after every `EFJSON_FEED_SLICE` codepoints,
+ * and the call returns early once it's nonzero, so a large input can be parsed in slices between other work.
+ * The budget is up to the caller, e.g. a clock, a cycle counter or a count of pending requests.
+ * @note The parser keeps its state, pass the rest of `src` in later calls.
+ * @return 0 if failed (and error will be writen to `dest[0]`), or the number of consumed codepoints.
+ */
+EFJSON_PUBLIC size_t efjsonStreamParser_feedUntil(
+  efjsonStreamParser* parser, efjsonToken* dest, const efjsonUint32* src, size_t len, int (*expired)(void* opaque),
+  void* opaque
+);
+#define EFJSON_FEED_SLICE 4096
+#if EFJSON_CONF_UTF_ENCODER
+/** A fragment of the input, it has the same layout as POSIX `struct iovec`. */
+typedef struct efjsonIovec {
+  const void* base;
+  size_t len;
+} efjsonIovec;
+/**
+ * Pass UTF-8 bytes scattered over `n` fragments to the parser, as if they were contiguous.
+ * A sequence straddling two fragments (or two calls) is carried over by `decoder`.
+ * `dest` and `chars` receive the token and the codepoint of each character, they need room for one per byte.
+ * @return 0 if failed (and error will be writen to `dest[0]`, invalid UTF-8 is `efjsonError_INVALID_INPUT_UTF`),
+ *         or the number of tokens if success.
+ */
+EFJSON_PUBLIC size_t efjsonStreamParser_feedv(
+  efjsonStreamParser* parser, efjsonUtf8Decoder* decoder, efjsonToken* dest, efjsonUint32* chars,
+  const efjsonIovec* iov, size_t n
+);
+#endif /* EFJSON_CONF_UTF_ENCODER */
+/**
+ * Skip UTF-8 bytes without generating tokens, until the nesting depth is back to `depth` and no string is open.
+ * Only quotes, escapes, brackets (and comments, if enabled) are inspected, and runs of other bytes are scanned
+ * in bulk (see `EFJSON_CONF_SIMD`), so the skipped content is not fully validated.
+ * A parser with limits (see `efjsonStreamParser_setLimits`) inspects every byte instead, so they're checked in time.
+ * @example After `efjsonType_ARRAY_START`/`efjsonType_OBJECT_START`, pass `depth - 1` to skip the whole container;
+ *          after `efjsonType_STRING_START`, pass the current depth to skip the string.
+ * @note The parser must be between tokens or inside a string, and it's left as if the consumed bytes were fed.
+ * @return The number of consumed bytes.
+ *         `token->done` will be set to 1 if the target is reached,
+ *         or `token->type` will be `efjsonType_ERROR` if failed (the returned value then points to the wrong byte).
+ */
+EFJSON_PUBLIC size_t efjsonStreamParser_skipUtf8(
+  efjsonStreamParser* parser, efjsonToken* token, efjsonStackLength depth, const efjsonUint8* src, size_t len
+);
+#if EFJSON_CONF_UTF_ENCODER
+/**
+ * Like `efjsonStreamParser_skipUtf8`, but the skipped content is fully validated (without generating tokens).
+ * `token` is the error token if failed, and invalid UTF-8 is reported as `efjsonError_INVALID_INPUT_UTF`.
+ */
+EFJSON_PUBLIC size_t efjsonStreamParser_skipValidUtf8(
+  efjsonStreamParser* parser, efjsonToken* token, efjsonStackLength depth, const efjsonUint8* src, size_t len
+);
+#endif
+EFJSON_PUBLIC efjsonStackLength efjsonStreamParser_getDepth(const efjsonStreamParser* parser);
+#if EFJSON_CONF_UTF_ENCODER
+/**
+ * Decode a run of `\uXXXX` escapes (surrogate pairs are combined) from UTF-8 bytes into UTF-8 at once,
+ * without generating tokens.
+ * The parser must be inside a string between characters, and `src` is the following input.
+ * It stops before anything else, including escapes which are errors, so they're left to the normal path.
+ * @note `dest` may be NULL to only validate, or may alias `src` (at most 3 bytes are written per 6 consumed).
+ *       A parser with limits consumes nothing, so the escapes are fed (and checked) one by one.
+ * @return The number of consumed bytes, and `*written` is set to the number of written bytes.
+ */
+EFJSON_PUBLIC size_t efjsonStreamParser_unescapeUtf8(
+  efjsonStreamParser* parser, efjsonUint8* dest, size_t* written, const efjsonUint8* src, size_t len
+);
+#endif /* EFJSON_CONF_UTF_ENCODER */
+#if EFJSON_CONF_NUMBER_VALUE
+/**
+ * Get the value of the last number as a 64-bit integer.
+ * The value is accumulated while parsing, so it's available once the number is ended
+ * (by the token after its last character), until the next number starts.
+ * @return 0 if the number is not an integer or out of range.
+ */
+EFJSON_PUBLIC int efjsonStreamParser_getInt64(const efjsonStreamParser* parser, efjsonInt64* value);
+/**
+ * Get the value of the last number as a correctly rounded `double`.
+ * Only the first 19 significant digits are kept, which is enough for almost every number.
+ * @return 0 if the rounding can't be decided by these digits, `*value` is still the nearest value of them.
+ */
+EFJSON_PUBLIC int efjsonStreamParser_getDouble(const efjsonStreamParser* parser, double* value);
+#endif /* EFJSON_CONF_NUMBER_VALUE */
+#if EFJSON_CONF_NUMBER_SPAN
+/**
+ * Get the layout of the last number, available once the number is ended (like `efjsonStreamParser_getInt64`).
+ * The digits themselves are not kept, read them from the source text with the offsets,
+ * so numbers of any length can be converted exactly on demand.
+ */
+EFJSON_PUBLIC void efjsonStreamParser_getNumberSpan(const efjsonStreamParser* parser, efjsonNumberSpan* span);
+#endif /* EFJSON_CONF_NUMBER_SPAN */
 
 EFJSON_PUBLIC efjsonPosition efjsonStreamParser_getLine(const efjsonStreamParser* parser);
 EFJSON_PUBLIC efjsonPosition efjsonStreamParser_getColumn(const efjsonStreamParser* parser);
@@ -764,6 +1031,9 @@ EFJSON_CODE_END
 #ifdef EFJSON_STREAM_IMPL
   #include <string.h>
   #include <stdlib.h>
+  #if EFJSON_CONF_SIMD
+    #include <emmintrin.h>
+  #endif
 
 EFJSON_CODE_BEGIN
   #define efjson_umax(T) efjson_cast(T, ~efjson_cast(T, 0))
@@ -848,7 +1118,8 @@ EFJSON_PUBLIC const char* efjson_stringifyLocation(efjsonUint8 location) {
   #if EFJSON_CONF_PRETTIER_ERROR
 EFJSON_PRIVATE const char* const efjson__ERROR_FORMAT1[] = {
   "<no error>",          "<allocation failed>",   "<too many recursions>",       "<position overflow>",
-  "<invalid input UTF>", "<invalid escaped UTF>", "<incomplete surrogate pair>",
+  "<invalid input UTF>", "<invalid escaped UTF>", "<incomplete surrogate pair>", "<too deep>",
+  "<string too long>",   "<number too long>",     "<too many values>",           "<input too long>",
 };
 EFJSON_PRIVATE const char* const efjson__ERROR_FORMAT2[] = {
   /* << other >> */
@@ -894,7 +1165,7 @@ EFJSON_PRIVATE const char* const efjson__ERROR_FORMAT2[] = {
 
 EFJSON_PUBLIC const char* efjson_stringifyError(efjsonUint8 error) {
   if(error < 0x80) {
-    if(error <= efjsonError_INCOMPLETE_SURROGATE_PAIR) return efjson__ERROR_FORMAT1[error];
+    if(error <= efjsonError_INPUT_TOO_LONG) return efjson__ERROR_FORMAT1[error];
   } else {
     if(error <= efjsonError_COMMENT_NOT_CLOSED) return efjson__ERROR_FORMAT2[error - 0x80];
   }
@@ -1505,6 +1776,55 @@ EFJSON_PUBLIC int efjsonUtf8Decoder_feed(efjsonUtf8Decoder* decoder, efjsonUint3
   *result = decoder->code;
   return 1;
 }
+EFJSON_PUBLIC size_t efjsonUtf8Decoder_decode(
+  efjsonUtf8Decoder* decoder, efjsonUint32* dest, const efjsonUint8* src, size_t len, size_t* consumed
+) {
+  size_t i = 0, count = 0, end;
+  int ret;
+  #if EFJSON_CONF_SIMD
+  const __m128i zero = _mm_setzero_si128();
+  __m128i v, lo, hi;
+  #else
+  size_t k;
+  unsigned m;
+  #endif
+  while(i < len) {
+    if(decoder->rest == 0 && len - i >= 16) {
+  #if EFJSON_CONF_SIMD
+      v = _mm_loadu_si128(efjson_cast(const __m128i*, efjson_cast(const void*, src + i)));
+      if(_mm_movemask_epi8(v) == 0) {
+        lo = _mm_unpacklo_epi8(v, zero);
+        hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128(efjson_cast(__m128i*, efjson_cast(void*, dest + count)), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(efjson_cast(__m128i*, efjson_cast(void*, dest + count + 4)), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(efjson_cast(__m128i*, efjson_cast(void*, dest + count + 8)), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(efjson_cast(__m128i*, efjson_cast(void*, dest + count + 12)), _mm_unpackhi_epi16(hi, zero));
+        i += 16;
+        count += 16;
+        continue;
+      }
+  #else
+      for(m = 0, k = 0; k < 16; ++k) m |= src[i + k];
+      if(m < 0x80) {
+        for(k = 0; k < 16; ++k) dest[count + k] = src[i + k];
+        i += 16;
+        count += 16;
+        continue;
+      }
+  #endif /* EFJSON_CONF_SIMD */
+    }
+    /* a block with non-ASCII bytes (or the tail) goes through the state machine */
+    for(end = len - i < 16 ? len : i + 16; i < end; ++i) {
+      if(ul_unlikely((ret = efjsonUtf8Decoder_feed(decoder, dest + count, src[i])) < 0)) {
+        *consumed = i;
+        return count;
+      }
+      count += efjson_cast(size_t, ret);
+    }
+  }
+  *consumed = i;
+  return count;
+}
 EFJSON_PUBLIC int efjson_EncodeUtf8(efjsonUint8* p, efjsonUint32 u) {
   efjsonUint8* q = p;
   if(u <= 0x7Fu) {
@@ -1547,6 +1867,7 @@ EFJSON_PUBLIC int efjsonUtf16Decoder_feed(efjsonUtf16Decoder* decoder, efjsonUin
   if(decoder->first != 0) {
     if(ul_likely(0xDC00u <= c && c <= 0xDFFFu)) {
       *result = (efjson_cast(efjsonUint32, decoder->first & 0x3FFu) << 10 | (c & 0x3FFu)) + 0x10000u;
+      decoder->first = 0;
       return 1;
     }
     return -1;
@@ -1572,9 +1893,549 @@ EFJSON_PUBLIC int efjson_EncodeUtf16(efjsonUint16* p, efjsonUint32 u) {
   }
   return -1;
 }
+
+EFJSON_PUBLIC enum efjsonEncoding efjson_detectEncoding(const efjsonUint8* src, size_t len, size_t* bom) {
+  *bom = 0;
+  if(len >= 4 && src[0] == 0 && src[1] == 0 && src[2] == 0xFE && src[3] == 0xFF) {
+    *bom = 4;
+    return efjsonEncoding_UTF32BE;
+  } else if(len >= 4 && src[0] == 0xFF && src[1] == 0xFE && src[2] == 0 && src[3] == 0) {
+    *bom = 4;
+    return efjsonEncoding_UTF32LE;
+  } else if(len >= 3 && src[0] == 0xEF && src[1] == 0xBB && src[2] == 0xBF) {
+    *bom = 3;
+    return efjsonEncoding_UTF8;
+  } else if(len >= 2 && src[0] == 0xFE && src[1] == 0xFF) {
+    *bom = 2;
+    return efjsonEncoding_UTF16BE;
+  } else if(len >= 2 && src[0] == 0xFF && src[1] == 0xFE) {
+    *bom = 2;
+    return efjsonEncoding_UTF16LE;
+  }
+  /* the first two characters are ASCII: 00 00 00 xx, 00 xx 00 xx, xx 00 00 00, xx 00 xx 00 */
+  if(len >= 4) {
+    if(src[0] == 0 && src[1] == 0 && src[2] == 0) return efjsonEncoding_UTF32BE;
+    if(src[1] == 0 && src[2] == 0 && src[3] == 0) return efjsonEncoding_UTF32LE;
+  }
+  if(len >= 2) {
+    if(src[0] == 0 && src[1] != 0) return efjsonEncoding_UTF16BE;
+    if(src[0] != 0 && src[1] == 0) return efjsonEncoding_UTF16LE;
+  }
+  return efjsonEncoding_UTF8;
+}
+EFJSON_PUBLIC size_t efjson_decodeUtf16(
+  efjsonUtf16Decoder* decoder, efjsonUint32* dest, const efjsonUint8* src, size_t len, int bigEndian, size_t* consumed
+) {
+  size_t i = 0, count = 0, end;
+  efjsonUint16 c;
+  int ret;
+  #if EFJSON_CONF_SIMD
+  const __m128i zero = _mm_setzero_si128(), high = _mm_set1_epi16(efjson_cast(short, 0xF800)),
+                surrogate = _mm_set1_epi16(efjson_cast(short, 0xD800));
+  __m128i v;
+  #endif
+  while(i < len) {
+  #if EFJSON_CONF_SIMD
+    if(decoder->first == 0 && len - i >= 8) {
+      v = _mm_loadu_si128(efjson_cast(const __m128i*, efjson_cast(const void*, src + 2 * i)));
+      if(bigEndian) v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+      if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, high), surrogate)) == 0) {
+        _mm_storeu_si128(efjson_cast(__m128i*, efjson_cast(void*, dest + count)), _mm_unpacklo_epi16(v, zero));
+        _mm_storeu_si128(efjson_cast(__m128i*, efjson_cast(void*, dest + count + 4)), _mm_unpackhi_epi16(v, zero));
+        i += 8;
+        count += 8;
+        continue;
+      }
+    }
+  #endif /* EFJSON_CONF_SIMD */
+    /* a block with surrogates (or the tail) goes unit by unit */
+    for(end = len - i < 8 ? len : i + 8; i < end; ++i) {
+      c = bigEndian ? efjson_cast(efjsonUint16, src[2 * i] << 8 | src[2 * i + 1])
+                    : efjson_cast(efjsonUint16, src[2 * i + 1] << 8 | src[2 * i]);
+      if(ul_unlikely((ret = efjsonUtf16Decoder_feed(decoder, dest + count, c)) < 0)) {
+        *consumed = i;
+        return count;
+      }
+      count += efjson_cast(size_t, ret);
+    }
+  }
+  *consumed = len;
+  return count;
+}
+EFJSON_PUBLIC size_t
+efjson_decodeUtf32(efjsonUint32* dest, const efjsonUint8* src, size_t len, int bigEndian, size_t* consumed) {
+  size_t i;
+  efjsonUint32 u;
+  for(i = 0; i < len; ++i, src += 4) {
+    u = bigEndian ? efjson_cast(efjsonUint32, src[0]) << 24 | efjson_cast(efjsonUint32, src[1]) << 16
+                      | efjson_cast(efjsonUint32, src[2]) << 8 | src[3]
+                  : efjson_cast(efjsonUint32, src[3]) << 24 | efjson_cast(efjsonUint32, src[2]) << 16
+                      | efjson_cast(efjsonUint32, src[1]) << 8 | src[0];
+    if(ul_unlikely(u > 0x10FFFFu || (u >= 0xD800u && u <= 0xDFFFu))) break;
+    dest[i] = u;
+  }
+  *consumed = i;
+  return i;
+}
   #endif /* EFJSON_CONF_UTF_ENCODER */
 
 
+  #if EFJSON_CONF_NUMBER_VALUE
+  /******************************
+   * Number conversion
+   ******************************/
+
+
+/**
+ * 128-bit approximations of 5^q for q in [-342, 308], normalized so that the highest bit is set
+ * (each entry is 4 32-bit words, from the highest to the lowest)
+ */
+EFJSON_PRIVATE const efjsonUint32 efjson__POWER_OF_FIVE[] = {
+  0xEEF453D6u, 0x923BD65Au, 0x113FAA29u, 0x06A13B3Fu, 0x9558B466u, 0x1B6565F8u, 0x4AC7CA59u, 0xA424C507u,
+  0xBAAEE17Fu, 0xA23EBF76u, 0x5D79BCF0u, 0x0D2DF649u, 0xE95A99DFu, 0x8ACE6F53u, 0xF4D82C2Cu, 0x107973DCu,
+  0x91D8A02Bu, 0xB6C10594u, 0x79071B9Bu, 0x8A4BE869u, 0xB64EC836u, 0xA47146F9u, 0x9748E282u, 0x6CDEE284u,
+  0xE3E27A44u, 0x4D8D98B7u, 0xFD1B1B23u, 0x08169B25u, 0x8E6D8C6Au, 0xB0787F72u, 0xFE30F0F5u, 0xE50E20F7u,
+  0xB208EF85u, 0x5C969F4Fu, 0xBDBD2D33u, 0x5E51A935u, 0xDE8B2B66u, 0xB3BC4723u, 0xAD2C7880u, 0x35E61382u,
+  0x8B16FB20u, 0x3055AC76u, 0x4C3BCB50u, 0x21AFCC31u, 0xADDCB9E8u, 0x3C6B1793u, 0xDF4ABE24u, 0x2A1BBF3Du,
+  0xD953E862u, 0x4B85DD78u, 0xD71D6DADu, 0x34A2AF0Du, 0x87D4713Du, 0x6F33AA6Bu, 0x8672648Cu, 0x40E5AD68u,
+  0xA9C98D8Cu, 0xCB009506u, 0x680EFDAFu, 0x511F18C2u, 0xD43BF0EFu, 0xFDC0BA48u, 0x0212BD1Bu, 0x2566DEF2u,
+  0x84A57695u, 0xFE98746Du, 0x014BB630u, 0xF7604B57u, 0xA5CED43Bu, 0x7E3E9188u, 0x419EA3BDu, 0x35385E2Du,
+  0xCF42894Au, 0x5DCE35EAu, 0x52064CACu, 0x828675B9u, 0x818995CEu, 0x7AA0E1B2u, 0x7343EFEBu, 0xD1940993u,
+  0xA1EBFB42u, 0x19491A1Fu, 0x1014EBE6u, 0xC5F90BF8u, 0xCA66FA12u, 0x9F9B60A6u, 0xD41A26E0u, 0x77774EF6u,
+  0xFD00B897u, 0x478238D0u, 0x8920B098u, 0x955522B4u, 0x9E20735Eu, 0x8CB16382u, 0x55B46E5Fu, 0x5D5535B0u,
+  0xC5A89036u, 0x2FDDBC62u, 0xEB2189F7u, 0x34AA831Du, 0xF712B443u, 0xBBD52B7Bu, 0xA5E9EC75u, 0x01D523E4u,
+  0x9A6BB0AAu, 0x55653B2Du, 0x47B233C9u, 0x2125366Eu, 0xC1069CD4u, 0xEABE89F8u, 0x999EC0BBu, 0x696E840Au,
+  0xF148440Au, 0x256E2C76u, 0xC00670EAu, 0x43CA250Du, 0x96CD2A86u, 0x5764DBCAu, 0x38040692u, 0x6A5E5728u,
+  0xBC807527u, 0xED3E12BCu, 0xC6050837u, 0x04F5ECF2u, 0xEBA09271u, 0xE88D976Bu, 0xF7864A44u, 0xC633682Eu,
+  0x93445B87u, 0x31587EA3u, 0x7AB3EE6Au, 0xFBE0211Du, 0xB8157268u, 0xFDAE9E4Cu, 0x5960EA05u, 0xBAD82964u,
+  0xE61ACF03u, 0x3D1A45DFu, 0x6FB92487u, 0x298E33BDu, 0x8FD0C162u, 0x06306BABu, 0xA5D3B6D4u, 0x79F8E056u,
+  0xB3C4F1BAu, 0x87BC8696u, 0x8F48A489u, 0x9877186Cu, 0xE0B62E29u, 0x29ABA83Cu, 0x331ACDABu, 0xFE94DE87u,
+  0x8C71DCD9u, 0xBA0B4925u, 0x9FF0C08Bu, 0x7F1D0B14u, 0xAF8E5410u, 0x288E1B6Fu, 0x07ECF0AEu, 0x5EE44DD9u,
+  0xDB71E914u, 0x32B1A24Au, 0xC9E82CD9u, 0xF69D6150u, 0x892731ACu, 0x9FAF056Eu, 0xBE311C08u, 0x3A225CD2u,
+  0xAB70FE17u, 0xC79AC6CAu, 0x6DBD630Au, 0x48AAF406u, 0xD64D3D9Du, 0xB981787Du, 0x092CBBCCu, 0xDAD5B108u,
+  0x85F04682u, 0x93F0EB4Eu, 0x25BBF560u, 0x08C58EA5u, 0xA76C5823u, 0x38ED2621u, 0xAF2AF2B8u, 0x0AF6F24Eu,
+  0xD1476E2Cu, 0x07286FAAu, 0x1AF5AF66u, 0x0DB4AEE1u, 0x82CCA4DBu, 0x847945CAu, 0x50D98D9Fu, 0xC890ED4Du,
+  0xA37FCE12u, 0x6597973Cu, 0xE50FF107u, 0xBAB528A0u, 0xCC5FC196u, 0xFEFD7D0Cu, 0x1E53ED49u, 0xA96272C8u,
+  0xFF77B1FCu, 0xBEBCDC4Fu, 0x25E8E89Cu, 0x13BB0F7Au, 0x9FAACF3Du, 0xF73609B1u, 0x77B19161u, 0x8C54E9ACu,
+  0xC795830Du, 0x75038C1Du, 0xD59DF5B9u, 0xEF6A2417u, 0xF97AE3D0u, 0xD2446F25u, 0x4B057328u, 0x6B44AD1Du,
+  0x9BECCE62u, 0x836AC577u, 0x4EE367F9u, 0x430AEC32u, 0xC2E801FBu, 0x244576D5u, 0x229C41F7u, 0x93CDA73Fu,
+  0xF3A20279u, 0xED56D48Au, 0x6B435275u, 0x78C1110Fu, 0x9845418Cu, 0x345644D6u, 0x830A1389u, 0x6B78AAA9u,
+  0xBE5691EFu, 0x416BD60Cu, 0x23CC986Bu, 0xC656D553u, 0xEDEC366Bu, 0x11C6CB8Fu, 0x2CBFBE86u, 0xB7EC8AA8u,
+  0x94B3A202u, 0xEB1C3F39u, 0x7BF7D714u, 0x32F3D6A9u, 0xB9E08A83u, 0xA5E34F07u, 0xDAF5CCD9u, 0x3FB0CC53u,
+  0xE858AD24u, 0x8F5C22C9u, 0xD1B3400Fu, 0x8F9CFF68u, 0x91376C36u, 0xD99995BEu, 0x23100809u, 0xB9C21FA1u,
+  0xB5854744u, 0x8FFFFB2Du, 0xABD40A0Cu, 0x2832A78Au, 0xE2E69915u, 0xB3FFF9F9u, 0x16C90C8Fu, 0x323F516Cu,
+  0x8DD01FADu, 0x907FFC3Bu, 0xAE3DA7D9u, 0x7F6792E3u, 0xB1442798u, 0xF49FFB4Au, 0x99CD11CFu, 0xDF41779Cu,
+  0xDD95317Fu, 0x31C7FA1Du, 0x40405643u, 0xD711D583u, 0x8A7D3EEFu, 0x7F1CFC52u, 0x482835EAu, 0x666B2572u,
+  0xAD1C8EABu, 0x5EE43B66u, 0xDA324365u, 0x0005EECFu, 0xD863B256u, 0x369D4A40u, 0x90BED43Eu, 0x40076A82u,
+  0x873E4F75u, 0xE2224E68u, 0x5A7744A6u, 0xE804A291u, 0xA90DE353u, 0x5AAAE202u, 0x711515D0u, 0xA205CB36u,
+  0xD3515C28u, 0x31559A83u, 0x0D5A5B44u, 0xCA873E03u, 0x8412D999u, 0x1ED58091u, 0xE858790Au, 0xFE9486C2u,
+  0xA5178FFFu, 0x668AE0B6u, 0x626E974Du, 0xBE39A872u, 0xCE5D73FFu, 0x402D98E3u, 0xFB0A3D21u, 0x2DC8128Fu,
+  0x80FA687Fu, 0x881C7F8Eu, 0x7CE66634u, 0xBC9D0B99u, 0xA139029Fu, 0x6A239F72u, 0x1C1FFFC1u, 0xEBC44E80u,
+  0xC9874347u, 0x44AC874Eu, 0xA327FFB2u, 0x66B56220u, 0xFBE91419u, 0x15D7A922u, 0x4BF1FF9Fu, 0x0062BAA8u,
+  0x9D71AC8Fu, 0xADA6C9B5u, 0x6F773FC3u, 0x603DB4A9u, 0xC4CE17B3u, 0x99107C22u, 0xCB550FB4u, 0x384D21D3u,
+  0xF6019DA0u, 0x7F549B2Bu, 0x7E2A53A1u, 0x46606A48u, 0x99C10284u, 0x4F94E0FBu, 0x2EDA7444u, 0xCBFC426Du,
+  0xC0314325u, 0x637A1939u, 0xFA911155u, 0xFEFB5308u, 0xF03D93EEu, 0xBC589F88u, 0x793555ABu, 0x7EBA27CAu,
+  0x96267C75u, 0x35B763B5u, 0x4BC1558Bu, 0x2F3458DEu, 0xBBB01B92u, 0x83253CA2u, 0x9EB1AAEDu, 0xFB016F16u,
+  0xEA9C2277u, 0x23EE8BCBu, 0x465E15A9u, 0x79C1CADCu, 0x92A1958Au, 0x7675175Fu, 0x0BFACD89u, 0xEC191EC9u,
+  0xB749FAEDu, 0x14125D36u, 0xCEF980ECu, 0x671F667Bu, 0xE51C79A8u, 0x5916F484u, 0x82B7E127u, 0x80E7401Au,
+  0x8F31CC09u, 0x37AE58D2u, 0xD1B2ECB8u, 0xB0908810u, 0xB2FE3F0Bu, 0x8599EF07u, 0x861FA7E6u, 0xDCB4AA15u,
+  0xDFBDCECEu, 0x67006AC9u, 0x67A791E0u, 0x93E1D49Au, 0x8BD6A141u, 0x006042BDu, 0xE0C8BB2Cu, 0x5C6D24E0u,
+  0xAECC4991u, 0x4078536Du, 0x58FAE9F7u, 0x73886E18u, 0xDA7F5BF5u, 0x90966848u, 0xAF39A475u, 0x506A899Eu,
+  0x888F9979u, 0x7A5E012Du, 0x6D8406C9u, 0x52429603u, 0xAAB37FD7u, 0xD8F58178u, 0xC8E5087Bu, 0xA6D33B83u,
+  0xD5605FCDu, 0xCF32E1D6u, 0xFB1E4A9Au, 0x90880A64u, 0x855C3BE0u, 0xA17FCD26u, 0x5CF2EEA0u, 0x9A55067Fu,
+  0xA6B34AD8u, 0xC9DFC06Fu, 0xF42FAA48u, 0xC0EA481Eu, 0xD0601D8Eu, 0xFC57B08Bu, 0xF13B94DAu, 0xF124DA26u,
+  0x823C1279u, 0x5DB6CE57u, 0x76C53D08u, 0xD6B70858u, 0xA2CB1717u, 0xB52481EDu, 0x54768C4Bu, 0x0C64CA6Eu,
+  0xCB7DDCDDu, 0xA26DA268u, 0xA9942F5Du, 0xCF7DFD09u, 0xFE5D5415u, 0x0B090B02u, 0xD3F93B35u, 0x435D7C4Cu,
+  0x9EFA548Du, 0x26E5A6E1u, 0xC47BC501u, 0x4A1A6DAFu, 0xC6B8E9B0u, 0x709F109Au, 0x359AB641u, 0x9CA1091Bu,
+  0xF867241Cu, 0x8CC6D4C0u, 0xC30163D2u, 0x03C94B62u, 0x9B407691u, 0xD7FC44F8u, 0x79E0DE63u, 0x425DCF1Du,
+  0xC2109436u, 0x4DFB5636u, 0x985915FCu, 0x12F542E4u, 0xF294B943u, 0xE17A2BC4u, 0x3E6F5B7Bu, 0x17B2939Du,
+  0x979CF3CAu, 0x6CEC5B5Au, 0xA705992Cu, 0xEECF9C42u, 0xBD8430BDu, 0x08277231u, 0x50C6FF78u, 0x2A838353u,
+  0xECE53CECu, 0x4A314EBDu, 0xA4F8BF56u, 0x35246428u, 0x940F4613u, 0xAE5ED136u, 0x871B7795u, 0xE136BE99u,
+  0xB9131798u, 0x99F68584u, 0x28E2557Bu, 0x59846E3Fu, 0xE757DD7Eu, 0xC07426E5u, 0x331AEADAu, 0x2FE589CFu,
+  0x9096EA6Fu, 0x3848984Fu, 0x3FF0D2C8u, 0x5DEF7621u, 0xB4BCA50Bu, 0x065ABE63u, 0x0FED077Au, 0x756B53A9u,
+  0xE1EBCE4Du, 0xC7F16DFBu, 0xD3E84959u, 0x12C62894u, 0x8D3360F0u, 0x9CF6E4BDu, 0x64712DD7u, 0xABBBD95Cu,
+  0xB080392Cu, 0xC4349DECu, 0xBD8D794Du, 0x96AACFB3u, 0xDCA04777u, 0xF541C567u, 0xECF0D7A0u, 0xFC5583A0u,
+  0x89E42CAAu, 0xF9491B60u, 0xF41686C4u, 0x9DB57244u, 0xAC5D37D5u, 0xB79B6239u, 0x311C2875u, 0xC522CED5u,
+  0xD77485CBu, 0x25823AC7u, 0x7D633293u, 0x366B828Bu, 0x86A8D39Eu, 0xF77164BCu, 0xAE5DFF9Cu, 0x02033197u,
+  0xA8530886u, 0xB54DBDEBu, 0xD9F57F83u, 0x0283FDFCu, 0xD267CAA8u, 0x62A12D66u, 0xD072DF63u, 0xC324FD7Bu,
+  0x8380DEA9u, 0x3DA4BC60u, 0x4247CB9Eu, 0x59F71E6Du, 0xA4611653u, 0x8D0DEB78u, 0x52D9BE85u, 0xF074E608u,
+  0xCD795BE8u, 0x70516656u, 0x67902E27u, 0x6C921F8Bu, 0x806BD971u, 0x4632DFF6u, 0x00BA1CD8u, 0xA3DB53B6u,
+  0xA086CFCDu, 0x97BF97F3u, 0x80E8A40Eu, 0xCCD228A4u, 0xC8A883C0u, 0xFDAF7DF0u, 0x6122CD12u, 0x8006B2CDu,
+  0xFAD2A4B1u, 0x3D1B5D6Cu, 0x796B8057u, 0x20085F81u, 0x9CC3A6EEu, 0xC6311A63u, 0xCBE33036u, 0x74053BB0u,
+  0xC3F490AAu, 0x77BD60FCu, 0xBEDBFC44u, 0x11068A9Cu, 0xF4F1B4D5u, 0x15ACB93Bu, 0xEE92FB55u, 0x15482D44u,
+  0x99171105u, 0x2D8BF3C5u, 0x751BDD15u, 0x2D4D1C4Au, 0xBF5CD546u, 0x78EEF0B6u, 0xD262D45Au, 0x78A0635Du,
+  0xEF340A98u, 0x172AACE4u, 0x86FB8971u, 0x16C87C34u, 0x9580869Fu, 0x0E7AAC0Eu, 0xD45D35E6u, 0xAE3D4DA0u,
+  0xBAE0A846u, 0xD2195712u, 0x89748360u, 0x59CCA109u, 0xE998D258u, 0x869FACD7u, 0x2BD1A438u, 0x703FC94Bu,
+  0x91FF8377u, 0x5423CC06u, 0x7B6306A3u, 0x4627DDCFu, 0xB67F6455u, 0x292CBF08u, 0x1A3BC84Cu, 0x17B1D542u,
+  0xE41F3D6Au, 0x7377EECAu, 0x20CABA5Fu, 0x1D9E4A93u, 0x8E938662u, 0x882AF53Eu, 0x547EB47Bu, 0x7282EE9Cu,
+  0xB23867FBu, 0x2A35B28Du, 0xE99E619Au, 0x4F23AA43u, 0xDEC681F9u, 0xF4C31F31u, 0x6405FA00u, 0xE2EC94D4u,
+  0x8B3C113Cu, 0x38F9F37Eu, 0xDE83BC40u, 0x8DD3DD04u, 0xAE0B158Bu, 0x4738705Eu, 0x9624AB50u, 0xB148D445u,
+  0xD98DDAEEu, 0x19068C76u, 0x3BADD624u, 0xDD9B0957u, 0x87F8A8D4u, 0xCFA417C9u, 0xE54CA5D7u, 0x0A80E5D6u,
+  0xA9F6D30Au, 0x038D1DBCu, 0x5E9FCF4Cu, 0xCD211F4Cu, 0xD47487CCu, 0x8470652Bu, 0x7647C320u, 0x0069671Fu,
+  0x84C8D4DFu, 0xD2C63F3Bu, 0x29ECD9F4u, 0x0041E073u, 0xA5FB0A17u, 0xC777CF09u, 0xF4681071u, 0x00525890u,
+  0xCF79CC9Du, 0xB955C2CCu, 0x7182148Du, 0x4066EEB4u, 0x81AC1FE2u, 0x93D599BFu, 0xC6F14CD8u, 0x48405530u,
+  0xA21727DBu, 0x38CB002Fu, 0xB8ADA00Eu, 0x5A506A7Cu, 0xCA9CF1D2u, 0x06FDC03Bu, 0xA6D90811u, 0xF0E4851Cu,
+  0xFD442E46u, 0x88BD304Au, 0x908F4A16u, 0x6D1DA663u, 0x9E4A9CECu, 0x15763E2Eu, 0x9A598E4Eu, 0x043287FEu,
+  0xC5DD4427u, 0x1AD3CDBAu, 0x40EFF1E1u, 0x853F29FDu, 0xF7549530u, 0xE188C128u, 0xD12BEE59u, 0xE68EF47Cu,
+  0x9A94DD3Eu, 0x8CF578B9u, 0x82BB74F8u, 0x301958CEu, 0xC13A148Eu, 0x3032D6E7u, 0xE36A5236u, 0x3C1FAF01u,
+  0xF18899B1u, 0xBC3F8CA1u, 0xDC44E6C3u, 0xCB279AC1u, 0x96F5600Fu, 0x15A7B7E5u, 0x29AB103Au, 0x5EF8C0B9u,
+  0xBCB2B812u, 0xDB11A5DEu, 0x7415D448u, 0xF6B6F0E7u, 0xEBDF6617u, 0x91D60F56u, 0x111B495Bu, 0x3464AD21u,
+  0x936B9FCEu, 0xBB25C995u, 0xCAB10DD9u, 0x00BEEC34u, 0xB84687C2u, 0x69EF3BFBu, 0x3D5D514Fu, 0x40EEA742u,
+  0xE65829B3u, 0x046B0AFAu, 0x0CB4A5A3u, 0x112A5112u, 0x8FF71A0Fu, 0xE2C2E6DCu, 0x47F0E785u, 0xEABA72ABu,
+  0xB3F4E093u, 0xDB73A093u, 0x59ED2167u, 0x65690F56u, 0xE0F218B8u, 0xD25088B8u, 0x306869C1u, 0x3EC3532Cu,
+  0x8C974F73u, 0x83725573u, 0x1E414218u, 0xC73A13FBu, 0xAFBD2350u, 0x644EEACFu, 0xE5D1929Eu, 0xF90898FAu,
+  0xDBAC6C24u, 0x7D62A583u, 0xDF45F746u, 0xB74ABF39u, 0x894BC396u, 0xCE5DA772u, 0x6B8BBA8Cu, 0x328EB783u,
+  0xAB9EB47Cu, 0x81F5114Fu, 0x066EA92Fu, 0x3F326564u, 0xD686619Bu, 0xA27255A2u, 0xC80A537Bu, 0x0EFEFEBDu,
+  0x8613FD01u, 0x45877585u, 0xBD06742Cu, 0xE95F5F36u, 0xA798FC41u, 0x96E952E7u, 0x2C481138u, 0x23B73704u,
+  0xD17F3B51u, 0xFCA3A7A0u, 0xF75A1586u, 0x2CA504C5u, 0x82EF8513u, 0x3DE648C4u, 0x9A984D73u, 0xDBE722FBu,
+  0xA3AB6658u, 0x0D5FDAF5u, 0xC13E60D0u, 0xD2E0EBBAu, 0xCC963FEEu, 0x10B7D1B3u, 0x318DF905u, 0x079926A8u,
+  0xFFBBCFE9u, 0x94E5C61Fu, 0xFDF17746u, 0x497F7052u, 0x9FD561F1u, 0xFD0F9BD3u, 0xFEB6EA8Bu, 0xEDEFA633u,
+  0xC7CABA6Eu, 0x7C5382C8u, 0xFE64A52Eu, 0xE96B8FC0u, 0xF9BD690Au, 0x1B68637Bu, 0x3DFDCE7Au, 0xA3C673B0u,
+  0x9C1661A6u, 0x51213E2Du, 0x06BEA10Cu, 0xA65C084Eu, 0xC31BFA0Fu, 0xE5698DB8u, 0x486E494Fu, 0xCFF30A62u,
+  0xF3E2F893u, 0xDEC3F126u, 0x5A89DBA3u, 0xC3EFCCFAu, 0x986DDB5Cu, 0x6B3A76B7u, 0xF8962946u, 0x5A75E01Cu,
+  0xBE895233u, 0x86091465u, 0xF6BBB397u, 0xF1135823u, 0xEE2BA6C0u, 0x678B597Fu, 0x746AA07Du, 0xED582E2Cu,
+  0x94DB4838u, 0x40B717EFu, 0xA8C2A44Eu, 0xB4571CDCu, 0xBA121A46u, 0x50E4DDEBu, 0x92F34D62u, 0x616CE413u,
+  0xE896A0D7u, 0xE51E1566u, 0x77B020BAu, 0xF9C81D17u, 0x915E2486u, 0xEF32CD60u, 0x0ACE1474u, 0xDC1D122Eu,
+  0xB5B5ADA8u, 0xAAFF80B8u, 0x0D819992u, 0x132456BAu, 0xE3231912u, 0xD5BF60E6u, 0x10E1FFF6u, 0x97ED6C69u,
+  0x8DF5EFABu, 0xC5979C8Fu, 0xCA8D3FFAu, 0x1EF463C1u, 0xB1736B96u, 0xB6FD83B3u, 0xBD308FF8u, 0xA6B17CB2u,
+  0xDDD0467Cu, 0x64BCE4A0u, 0xAC7CB3F6u, 0xD05DDBDEu, 0x8AA22C0Du, 0xBEF60EE4u, 0x6BCDF07Au, 0x423AA96Bu,
+  0xAD4AB711u, 0x2EB3929Du, 0x86C16C98u, 0xD2C953C6u, 0xD89D64D5u, 0x7A607744u, 0xE871C7BFu, 0x077BA8B7u,
+  0x87625F05u, 0x6C7C4A8Bu, 0x11471CD7u, 0x64AD4972u, 0xA93AF6C6u, 0xC79B5D2Du, 0xD598E40Du, 0x3DD89BCFu,
+  0xD389B478u, 0x79823479u, 0x4AFF1D10u, 0x8D4EC2C3u, 0x843610CBu, 0x4BF160CBu, 0xCEDF722Au, 0x585139BAu,
+  0xA54394FEu, 0x1EEDB8FEu, 0xC2974EB4u, 0xEE658828u, 0xCE947A3Du, 0xA6A9273Eu, 0x733D2262u, 0x29FEEA32u,
+  0x811CCC66u, 0x8829B887u, 0x0806357Du, 0x5A3F525Fu, 0xA163FF80u, 0x2A3426A8u, 0xCA07C2DCu, 0xB0CF26F7u,
+  0xC9BCFF60u, 0x34C13052u, 0xFC89B393u, 0xDD02F0B5u, 0xFC2C3F38u, 0x41F17C67u, 0xBBAC2078u, 0xD443ACE2u,
+  0x9D9BA783u, 0x2936EDC0u, 0xD54B944Bu, 0x84AA4C0Du, 0xC5029163u, 0xF384A931u, 0x0A9E795Eu, 0x65D4DF11u,
+  0xF64335BCu, 0xF065D37Du, 0x4D4617B5u, 0xFF4A16D5u, 0x99EA0196u, 0x163FA42Eu, 0x504BCED1u, 0xBF8E4E45u,
+  0xC06481FBu, 0x9BCF8D39u, 0xE45EC286u, 0x2F71E1D6u, 0xF07DA27Au, 0x82C37088u, 0x5D767327u, 0xBB4E5A4Cu,
+  0x964E858Cu, 0x91BA2655u, 0x3A6A07F8u, 0xD510F86Fu, 0xBBE226EFu, 0xB628AFEAu, 0x890489F7u, 0x0A55368Bu,
+  0xEADAB0ABu, 0xA3B2DBE5u, 0x2B45AC74u, 0xCCEA842Eu, 0x92C8AE6Bu, 0x464FC96Fu, 0x3B0B8BC9u, 0x0012929Du,
+  0xB77ADA06u, 0x17E3BBCBu, 0x09CE6EBBu, 0x40173744u, 0xE5599087u, 0x9DDCAABDu, 0xCC420A6Au, 0x101D0515u,
+  0x8F57FA54u, 0xC2A9EAB6u, 0x9FA94682u, 0x4A12232Du, 0xB32DF8E9u, 0xF3546564u, 0x47939822u, 0xDC96ABF9u,
+  0xDFF97724u, 0x70297EBDu, 0x59787E2Bu, 0x93BC56F7u, 0x8BFBEA76u, 0xC619EF36u, 0x57EB4EDBu, 0x3C55B65Au,
+  0xAEFAE514u, 0x77A06B03u, 0xEDE62292u, 0x0B6B23F1u, 0xDAB99E59u, 0x958885C4u, 0xE95FAB36u, 0x8E45ECEDu,
+  0x88B402F7u, 0xFD75539Bu, 0x11DBCB02u, 0x18EBB414u, 0xAAE103B5u, 0xFCD2A881u, 0xD652BDC2u, 0x9F26A119u,
+  0xD59944A3u, 0x7C0752A2u, 0x4BE76D33u, 0x46F0495Fu, 0x857FCAE6u, 0x2D8493A5u, 0x6F70A440u, 0x0C562DDBu,
+  0xA6DFBD9Fu, 0xB8E5B88Eu, 0xCB4CCD50u, 0x0F6BB952u, 0xD097AD07u, 0xA71F26B2u, 0x7E2000A4u, 0x1346A7A7u,
+  0x825ECC24u, 0xC873782Fu, 0x8ED40066u, 0x8C0C28C8u, 0xA2F67F2Du, 0xFA90563Bu, 0x72890080u, 0x2F0F32FAu,
+  0xCBB41EF9u, 0x79346BCAu, 0x4F2B40A0u, 0x3AD2FFB9u, 0xFEA126B7u, 0xD78186BCu, 0xE2F610C8u, 0x4987BFA8u,
+  0x9F24B832u, 0xE6B0F436u, 0x0DD9CA7Du, 0x2DF4D7C9u, 0xC6EDE63Fu, 0xA05D3143u, 0x91503D1Cu, 0x79720DBBu,
+  0xF8A95FCFu, 0x88747D94u, 0x75A44C63u, 0x97CE912Au, 0x9B69DBE1u, 0xB548CE7Cu, 0xC986AFBEu, 0x3EE11ABAu,
+  0xC24452DAu, 0x229B021Bu, 0xFBE85BADu, 0xCE996168u, 0xF2D56790u, 0xAB41C2A2u, 0xFAE27299u, 0x423FB9C3u,
+  0x97C560BAu, 0x6B0919A5u, 0xDCCD879Fu, 0xC967D41Au, 0xBDB6B8E9u, 0x05CB600Fu, 0x5400E987u, 0xBBC1C920u,
+  0xED246723u, 0x473E3813u, 0x290123E9u, 0xAAB23B68u, 0x9436C076u, 0x0C86E30Bu, 0xF9A0B672u, 0x0AAF6521u,
+  0xB9447093u, 0x8FA89BCEu, 0xF808E40Eu, 0x8D5B3E69u, 0xE7958CB8u, 0x7392C2C2u, 0xB60B1D12u, 0x30B20E04u,
+  0x90BD77F3u, 0x483BB9B9u, 0xB1C6F22Bu, 0x5E6F48C2u, 0xB4ECD5F0u, 0x1A4AA828u, 0x1E38AEB6u, 0x360B1AF3u,
+  0xE2280B6Cu, 0x20DD5232u, 0x25C6DA63u, 0xC38DE1B0u, 0x8D590723u, 0x948A535Fu, 0x579C487Eu, 0x5A38AD0Eu,
+  0xB0AF48ECu, 0x79ACE837u, 0x2D835A9Du, 0xF0C6D851u, 0xDCDB1B27u, 0x98182244u, 0xF8E43145u, 0x6CF88E65u,
+  0x8A08F0F8u, 0xBF0F156Bu, 0x1B8E9ECBu, 0x641B58FFu, 0xAC8B2D36u, 0xEED2DAC5u, 0xE272467Eu, 0x3D222F3Fu,
+  0xD7ADF884u, 0xAA879177u, 0x5B0ED81Du, 0xCC6ABB0Fu, 0x86CCBB52u, 0xEA94BAEAu, 0x98E94712u, 0x9FC2B4E9u,
+  0xA87FEA27u, 0xA539E9A5u, 0x3F2398D7u, 0x47B36224u, 0xD29FE4B1u, 0x8E88640Eu, 0x8EEC7F0Du, 0x19A03AADu,
+  0x83A3EEEEu, 0xF9153E89u, 0x1953CF68u, 0x300424ACu, 0xA48CEAAAu, 0xB75A8E2Bu, 0x5FA8C342u, 0x3C052DD7u,
+  0xCDB02555u, 0x653131B6u, 0x3792F412u, 0xCB06794Du, 0x808E1755u, 0x5F3EBF11u, 0xE2BBD88Bu, 0xBEE40BD0u,
+  0xA0B19D2Au, 0xB70E6ED6u, 0x5B6ACEAEu, 0xAE9D0EC4u, 0xC8DE0475u, 0x64D20A8Bu, 0xF245825Au, 0x5A445275u,
+  0xFB158592u, 0xBE068D2Eu, 0xEED6E2F0u, 0xF0D56712u, 0x9CED737Bu, 0xB6C4183Du, 0x55464DD6u, 0x9685606Bu,
+  0xC428D05Au, 0xA4751E4Cu, 0xAA97E14Cu, 0x3C26B886u, 0xF5330471u, 0x4D9265DFu, 0xD53DD99Fu, 0x4B3066A8u,
+  0x993FE2C6u, 0xD07B7FABu, 0xE546A803u, 0x8EFE4029u, 0xBF8FDB78u, 0x849A5F96u, 0xDE985204u, 0x72BDD033u,
+  0xEF73D256u, 0xA5C0F77Cu, 0x963E6685u, 0x8F6D4440u, 0x95A86376u, 0x27989AADu, 0xDDE70013u, 0x79A44AA8u,
+  0xBB127C53u, 0xB17EC159u, 0x5560C018u, 0x580D5D52u, 0xE9D71B68u, 0x9DDE71AFu, 0xAAB8F01Eu, 0x6E10B4A6u,
+  0x92267121u, 0x62AB070Du, 0xCAB39613u, 0x04CA70E8u, 0xB6B00D69u, 0xBB55C8D1u, 0x3D607B97u, 0xC5FD0D22u,
+  0xE45C10C4u, 0x2A2B3B05u, 0x8CB89A7Du, 0xB77C506Au, 0x8EB98A7Au, 0x9A5B04E3u, 0x77F3608Eu, 0x92ADB242u,
+  0xB267ED19u, 0x40F1C61Cu, 0x55F038B2u, 0x37591ED3u, 0xDF01E85Fu, 0x912E37A3u, 0x6B6C46DEu, 0xC52F6688u,
+  0x8B61313Bu, 0xBABCE2C6u, 0x2323AC4Bu, 0x3B3DA015u, 0xAE397D8Au, 0xA96C1B77u, 0xABEC975Eu, 0x0A0D081Au,
+  0xD9C7DCEDu, 0x53C72255u, 0x96E7BD35u, 0x8C904A21u, 0x881CEA14u, 0x545C7575u, 0x7E50D641u, 0x77DA2E54u,
+  0xAA242499u, 0x697392D2u, 0xDDE50BD1u, 0xD5D0B9E9u, 0xD4AD2DBFu, 0xC3D07787u, 0x955E4EC6u, 0x4B44E864u,
+  0x84EC3C97u, 0xDA624AB4u, 0xBD5AF13Bu, 0xEF0B113Eu, 0xA6274BBDu, 0xD0FADD61u, 0xECB1AD8Au, 0xEACDD58Eu,
+  0xCFB11EADu, 0x453994BAu, 0x67DE18EDu, 0xA5814AF2u, 0x81CEB32Cu, 0x4B43FCF4u, 0x80EACF94u, 0x8770CED7u,
+  0xA2425FF7u, 0x5E14FC31u, 0xA1258379u, 0xA94D028Du, 0xCAD2F7F5u, 0x359A3B3Eu, 0x096EE458u, 0x13A04330u,
+  0xFD87B5F2u, 0x8300CA0Du, 0x8BCA9D6Eu, 0x188853FCu, 0x9E74D1B7u, 0x91E07E48u, 0x775EA264u, 0xCF55347Eu,
+  0xC6120625u, 0x76589DDAu, 0x95364AFEu, 0x032A819Eu, 0xF79687AEu, 0xD3EEC551u, 0x3A83DDBDu, 0x83F52205u,
+  0x9ABE14CDu, 0x44753B52u, 0xC4926A96u, 0x72793543u, 0xC16D9A00u, 0x95928A27u, 0x75B7053Cu, 0x0F178294u,
+  0xF1C90080u, 0xBAF72CB1u, 0x5324C68Bu, 0x12DD6339u, 0x971DA050u, 0x74DA7BEEu, 0xD3F6FC16u, 0xEBCA5E04u,
+  0xBCE50864u, 0x92111AEAu, 0x88F4BB1Cu, 0xA6BCF585u, 0xEC1E4A7Du, 0xB69561A5u, 0x2B31E9E3u, 0xD06C32E6u,
+  0x9392EE8Eu, 0x921D5D07u, 0x3AFF322Eu, 0x62439FD0u, 0xB877AA32u, 0x36A4B449u, 0x09BEFEB9u, 0xFAD487C3u,
+  0xE69594BEu, 0xC44DE15Bu, 0x4C2EBE68u, 0x7989A9B4u, 0x901D7CF7u, 0x3AB0ACD9u, 0x0F9D3701u, 0x4BF60A11u,
+  0xB424DC35u, 0x095CD80Fu, 0x538484C1u, 0x9EF38C95u, 0xE12E1342u, 0x4BB40E13u, 0x2865A5F2u, 0x06B06FBAu,
+  0x8CBCCC09u, 0x6F5088CBu, 0xF93F87B7u, 0x442E45D4u, 0xAFEBFF0Bu, 0xCB24AAFEu, 0xF78F69A5u, 0x1539D749u,
+  0xDBE6FECEu, 0xBDEDD5BEu, 0xB573440Eu, 0x5A884D1Cu, 0x89705F41u, 0x36B4A597u, 0x31680A88u, 0xF8953031u,
+  0xABCC7711u, 0x8461CEFCu, 0xFDC20D2Bu, 0x36BA7C3Eu, 0xD6BF94D5u, 0xE57A42BCu, 0x3D329076u, 0x04691B4Du,
+  0x8637BD05u, 0xAF6C69B5u, 0xA63F9A49u, 0xC2C1B110u, 0xA7C5AC47u, 0x1B478423u, 0x0FCF80DCu, 0x33721D54u,
+  0xD1B71758u, 0xE219652Bu, 0xD3C36113u, 0x404EA4A9u, 0x83126E97u, 0x8D4FDF3Bu, 0x645A1CACu, 0x083126EAu,
+  0xA3D70A3Du, 0x70A3D70Au, 0x3D70A3D7u, 0x0A3D70A4u, 0xCCCCCCCCu, 0xCCCCCCCCu, 0xCCCCCCCCu, 0xCCCCCCCDu,
+  0x80000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0xA0000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0xC8000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0xFA000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x9C400000u, 0x00000000u, 0x00000000u, 0x00000000u, 0xC3500000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0xF4240000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x98968000u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0xBEBC2000u, 0x00000000u, 0x00000000u, 0x00000000u, 0xEE6B2800u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0x9502F900u, 0x00000000u, 0x00000000u, 0x00000000u, 0xBA43B740u, 0x00000000u, 0x00000000u, 0x00000000u,
+  0xE8D4A510u, 0x00000000u, 0x00000000u, 0x00000000u, 0x9184E72Au, 0x00000000u, 0x00000000u, 0x00000000u,
+  0xB5E620F4u, 0x80000000u, 0x00000000u, 0x00000000u, 0xE35FA931u, 0xA0000000u, 0x00000000u, 0x00000000u,
+  0x8E1BC9BFu, 0x04000000u, 0x00000000u, 0x00000000u, 0xB1A2BC2Eu, 0xC5000000u, 0x00000000u, 0x00000000u,
+  0xDE0B6B3Au, 0x76400000u, 0x00000000u, 0x00000000u, 0x8AC72304u, 0x89E80000u, 0x00000000u, 0x00000000u,
+  0xAD78EBC5u, 0xAC620000u, 0x00000000u, 0x00000000u, 0xD8D726B7u, 0x177A8000u, 0x00000000u, 0x00000000u,
+  0x87867832u, 0x6EAC9000u, 0x00000000u, 0x00000000u, 0xA968163Fu, 0x0A57B400u, 0x00000000u, 0x00000000u,
+  0xD3C21BCEu, 0xCCEDA100u, 0x00000000u, 0x00000000u, 0x84595161u, 0x401484A0u, 0x00000000u, 0x00000000u,
+  0xA56FA5B9u, 0x9019A5C8u, 0x00000000u, 0x00000000u, 0xCECB8F27u, 0xF4200F3Au, 0x00000000u, 0x00000000u,
+  0x813F3978u, 0xF8940984u, 0x40000000u, 0x00000000u, 0xA18F07D7u, 0x36B90BE5u, 0x50000000u, 0x00000000u,
+  0xC9F2C9CDu, 0x04674EDEu, 0xA4000000u, 0x00000000u, 0xFC6F7C40u, 0x45812296u, 0x4D000000u, 0x00000000u,
+  0x9DC5ADA8u, 0x2B70B59Du, 0xF0200000u, 0x00000000u, 0xC5371912u, 0x364CE305u, 0x6C280000u, 0x00000000u,
+  0xF684DF56u, 0xC3E01BC6u, 0xC7320000u, 0x00000000u, 0x9A130B96u, 0x3A6C115Cu, 0x3C7F4000u, 0x00000000u,
+  0xC097CE7Bu, 0xC90715B3u, 0x4B9F1000u, 0x00000000u, 0xF0BDC21Au, 0xBB48DB20u, 0x1E86D400u, 0x00000000u,
+  0x96769950u, 0xB50D88F4u, 0x13144480u, 0x00000000u, 0xBC143FA4u, 0xE250EB31u, 0x17D955A0u, 0x00000000u,
+  0xEB194F8Eu, 0x1AE525FDu, 0x5DCFAB08u, 0x00000000u, 0x92EFD1B8u, 0xD0CF37BEu, 0x5AA1CAE5u, 0x00000000u,
+  0xB7ABC627u, 0x050305ADu, 0xF14A3D9Eu, 0x40000000u, 0xE596B7B0u, 0xC643C719u, 0x6D9CCD05u, 0xD0000000u,
+  0x8F7E32CEu, 0x7BEA5C6Fu, 0xE4820023u, 0xA2000000u, 0xB35DBF82u, 0x1AE4F38Bu, 0xDDA2802Cu, 0x8A800000u,
+  0xE0352F62u, 0xA19E306Eu, 0xD50B2037u, 0xAD200000u, 0x8C213D9Du, 0xA502DE45u, 0x4526F422u, 0xCC340000u,
+  0xAF298D05u, 0x0E4395D6u, 0x9670B12Bu, 0x7F410000u, 0xDAF3F046u, 0x51D47B4Cu, 0x3C0CDD76u, 0x5F114000u,
+  0x88D8762Bu, 0xF324CD0Fu, 0xA5880A69u, 0xFB6AC800u, 0xAB0E93B6u, 0xEFEE0053u, 0x8EEA0D04u, 0x7A457A00u,
+  0xD5D238A4u, 0xABE98068u, 0x72A49045u, 0x98D6D880u, 0x85A36366u, 0xEB71F041u, 0x47A6DA2Bu, 0x7F864750u,
+  0xA70C3C40u, 0xA64E6C51u, 0x999090B6u, 0x5F67D924u, 0xD0CF4B50u, 0xCFE20765u, 0xFFF4B4E3u, 0xF741CF6Du,
+  0x82818F12u, 0x81ED449Fu, 0xBFF8F10Eu, 0x7A8921A4u, 0xA321F2D7u, 0x226895C7u, 0xAFF72D52u, 0x192B6A0Du,
+  0xCBEA6F8Cu, 0xEB02BB39u, 0x9BF4F8A6u, 0x9F764490u, 0xFEE50B70u, 0x25C36A08u, 0x02F236D0u, 0x4753D5B4u,
+  0x9F4F2726u, 0x179A2245u, 0x01D76242u, 0x2C946590u, 0xC722F0EFu, 0x9D80AAD6u, 0x424D3AD2u, 0xB7B97EF5u,
+  0xF8EBAD2Bu, 0x84E0D58Bu, 0xD2E08987u, 0x65A7DEB2u, 0x9B934C3Bu, 0x330C8577u, 0x63CC55F4u, 0x9F88EB2Fu,
+  0xC2781F49u, 0xFFCFA6D5u, 0x3CBF6B71u, 0xC76B25FBu, 0xF316271Cu, 0x7FC3908Au, 0x8BEF464Eu, 0x3945EF7Au,
+  0x97EDD871u, 0xCFDA3A56u, 0x97758BF0u, 0xE3CBB5ACu, 0xBDE94E8Eu, 0x43D0C8ECu, 0x3D52EEEDu, 0x1CBEA317u,
+  0xED63A231u, 0xD4C4FB27u, 0x4CA7AAA8u, 0x63EE4BDDu, 0x945E455Fu, 0x24FB1CF8u, 0x8FE8CAA9u, 0x3E74EF6Au,
+  0xB975D6B6u, 0xEE39E436u, 0xB3E2FD53u, 0x8E122B44u, 0xE7D34C64u, 0xA9C85D44u, 0x60DBBCA8u, 0x7196B616u,
+  0x90E40FBEu, 0xEA1D3A4Au, 0xBC8955E9u, 0x46FE31CDu, 0xB51D13AEu, 0xA4A488DDu, 0x6BABAB63u, 0x98BDBE41u,
+  0xE264589Au, 0x4DCDAB14u, 0xC696963Cu, 0x7EED2DD1u, 0x8D7EB760u, 0x70A08AECu, 0xFC1E1DE5u, 0xCF543CA2u,
+  0xB0DE6538u, 0x8CC8ADA8u, 0x3B25A55Fu, 0x43294BCBu, 0xDD15FE86u, 0xAFFAD912u, 0x49EF0EB7u, 0x13F39EBEu,
+  0x8A2DBF14u, 0x2DFCC7ABu, 0x6E356932u, 0x6C784337u, 0xACB92ED9u, 0x397BF996u, 0x49C2C37Fu, 0x07965404u,
+  0xD7E77A8Fu, 0x87DAF7FBu, 0xDC33745Eu, 0xC97BE906u, 0x86F0AC99u, 0xB4E8DAFDu, 0x69A028BBu, 0x3DED71A3u,
+  0xA8ACD7C0u, 0x222311BCu, 0xC40832EAu, 0x0D68CE0Cu, 0xD2D80DB0u, 0x2AABD62Bu, 0xF50A3FA4u, 0x90C30190u,
+  0x83C7088Eu, 0x1AAB65DBu, 0x792667C6u, 0xDA79E0FAu, 0xA4B8CAB1u, 0xA1563F52u, 0x577001B8u, 0x91185938u,
+  0xCDE6FD5Eu, 0x09ABCF26u, 0xED4C0226u, 0xB55E6F86u, 0x80B05E5Au, 0xC60B6178u, 0x544F8158u, 0x315B05B4u,
+  0xA0DC75F1u, 0x778E39D6u, 0x696361AEu, 0x3DB1C721u, 0xC913936Du, 0xD571C84Cu, 0x03BC3A19u, 0xCD1E38E9u,
+  0xFB587849u, 0x4ACE3A5Fu, 0x04AB48A0u, 0x4065C723u, 0x9D174B2Du, 0xCEC0E47Bu, 0x62EB0D64u, 0x283F9C76u,
+  0xC45D1DF9u, 0x42711D9Au, 0x3BA5D0BDu, 0x324F8394u, 0xF5746577u, 0x930D6500u, 0xCA8F44ECu, 0x7EE36479u,
+  0x9968BF6Au, 0xBBE85F20u, 0x7E998B13u, 0xCF4E1ECBu, 0xBFC2EF45u, 0x6AE276E8u, 0x9E3FEDD8u, 0xC321A67Eu,
+  0xEFB3AB16u, 0xC59B14A2u, 0xC5CFE94Eu, 0xF3EA101Eu, 0x95D04AEEu, 0x3B80ECE5u, 0xBBA1F1D1u, 0x58724A12u,
+  0xBB445DA9u, 0xCA61281Fu, 0x2A8A6E45u, 0xAE8EDC97u, 0xEA157514u, 0x3CF97226u, 0xF52D09D7u, 0x1A3293BDu,
+  0x924D692Cu, 0xA61BE758u, 0x593C2626u, 0x705F9C56u, 0xB6E0C377u, 0xCFA2E12Eu, 0x6F8B2FB0u, 0x0C77836Cu,
+  0xE498F455u, 0xC38B997Au, 0x0B6DFB9Cu, 0x0F956447u, 0x8EDF98B5u, 0x9A373FECu, 0x4724BD41u, 0x89BD5EACu,
+  0xB2977EE3u, 0x00C50FE7u, 0x58EDEC91u, 0xEC2CB657u, 0xDF3D5E9Bu, 0xC0F653E1u, 0x2F2967B6u, 0x6737E3EDu,
+  0x8B865B21u, 0x5899F46Cu, 0xBD79E0D2u, 0x0082EE74u, 0xAE67F1E9u, 0xAEC07187u, 0xECD85906u, 0x80A3AA11u,
+  0xDA01EE64u, 0x1A708DE9u, 0xE80E6F48u, 0x20CC9495u, 0x884134FEu, 0x908658B2u, 0x3109058Du, 0x147FDCDDu,
+  0xAA51823Eu, 0x34A7EEDEu, 0xBD4B46F0u, 0x599FD415u, 0xD4E5E2CDu, 0xC1D1EA96u, 0x6C9E18ACu, 0x7007C91Au,
+  0x850FADC0u, 0x9923329Eu, 0x03E2CF6Bu, 0xC604DDB0u, 0xA6539930u, 0xBF6BFF45u, 0x84DB8346u, 0xB786151Cu,
+  0xCFE87F7Cu, 0xEF46FF16u, 0xE6126418u, 0x65679A63u, 0x81F14FAEu, 0x158C5F6Eu, 0x4FCB7E8Fu, 0x3F60C07Eu,
+  0xA26DA399u, 0x9AEF7749u, 0xE3BE5E33u, 0x0F38F09Du, 0xCB090C80u, 0x01AB551Cu, 0x5CADF5BFu, 0xD3072CC5u,
+  0xFDCB4FA0u, 0x02162A63u, 0x73D9732Fu, 0xC7C8F7F6u, 0x9E9F11C4u, 0x014DDA7Eu, 0x2867E7FDu, 0xDCDD9AFAu,
+  0xC646D635u, 0x01A1511Du, 0xB281E1FDu, 0x541501B8u, 0xF7D88BC2u, 0x4209A565u, 0x1F225A7Cu, 0xA91A4226u,
+  0x9AE75759u, 0x6946075Fu, 0x3375788Du, 0xE9B06958u, 0xC1A12D2Fu, 0xC3978937u, 0x0052D6B1u, 0x641C83AEu,
+  0xF209787Bu, 0xB47D6B84u, 0xC0678C5Du, 0xBD23A49Au, 0x9745EB4Du, 0x50CE6332u, 0xF840B7BAu, 0x963646E0u,
+  0xBD176620u, 0xA501FBFFu, 0xB650E5A9u, 0x3BC3D898u, 0xEC5D3FA8u, 0xCE427AFFu, 0xA3E51F13u, 0x8AB4CEBEu,
+  0x93BA47C9u, 0x80E98CDFu, 0xC66F336Cu, 0x36B10137u, 0xB8A8D9BBu, 0xE123F017u, 0xB80B0047u, 0x445D4184u,
+  0xE6D3102Au, 0xD96CEC1Du, 0xA60DC059u, 0x157491E5u, 0x9043EA1Au, 0xC7E41392u, 0x87C89837u, 0xAD68DB2Fu,
+  0xB454E4A1u, 0x79DD1877u, 0x29BABE45u, 0x98C311FBu, 0xE16A1DC9u, 0xD8545E94u, 0xF4296DD6u, 0xFEF3D67Au,
+  0x8CE2529Eu, 0x2734BB1Du, 0x1899E4A6u, 0x5F58660Cu, 0xB01AE745u, 0xB101E9E4u, 0x5EC05DCFu, 0xF72E7F8Fu,
+  0xDC21A117u, 0x1D42645Du, 0x76707543u, 0xF4FA1F73u, 0x899504AEu, 0x72497EBAu, 0x6A06494Au, 0x791C53A8u,
+  0xABFA45DAu, 0x0EDBDE69u, 0x0487DB9Du, 0x17636892u, 0xD6F8D750u, 0x9292D603u, 0x45A9D284u, 0x5D3C42B6u,
+  0x865B8692u, 0x5B9BC5C2u, 0x0B8A2392u, 0xBA45A9B2u, 0xA7F26836u, 0xF282B732u, 0x8E6CAC77u, 0x68D7141Eu,
+  0xD1EF0244u, 0xAF2364FFu, 0x3207D795u, 0x430CD926u, 0x8335616Au, 0xED761F1Fu, 0x7F44E6BDu, 0x49E807B8u,
+  0xA402B9C5u, 0xA8D3A6E7u, 0x5F16206Cu, 0x9C6209A6u, 0xCD036837u, 0x130890A1u, 0x36DBA887u, 0xC37A8C0Fu,
+  0x80222122u, 0x6BE55A64u, 0xC2494954u, 0xDA2C9789u, 0xA02AA96Bu, 0x06DEB0FDu, 0xF2DB9BAAu, 0x10B7BD6Cu,
+  0xC83553C5u, 0xC8965D3Du, 0x6F928294u, 0x94E5ACC7u, 0xFA42A8B7u, 0x3ABBF48Cu, 0xCB772339u, 0xBA1F17F9u,
+  0x9C69A972u, 0x84B578D7u, 0xFF2A7604u, 0x14536EFBu, 0xC38413CFu, 0x25E2D70Du, 0xFEF51385u, 0x19684ABAu,
+  0xF46518C2u, 0xEF5B8CD1u, 0x7EB25866u, 0x5FC25D69u, 0x98BF2F79u, 0xD5993802u, 0xEF2F773Fu, 0xFBD97A61u,
+  0xBEEEFB58u, 0x4AFF8603u, 0xAAFB550Fu, 0xFACFD8FAu, 0xEEAABA2Eu, 0x5DBF6784u, 0x95BA2A53u, 0xF983CF38u,
+  0x952AB45Cu, 0xFA97A0B2u, 0xDD945A74u, 0x7BF26183u, 0xBA756174u, 0x393D88DFu, 0x94F97111u, 0x9AEEF9E4u,
+  0xE912B9D1u, 0x478CEB17u, 0x7A37CD56u, 0x01AAB85Du, 0x91ABB422u, 0xCCB812EEu, 0xAC62E055u, 0xC10AB33Au,
+  0xB616A12Bu, 0x7FE617AAu, 0x577B986Bu, 0x314D6009u, 0xE39C4976u, 0x5FDF9D94u, 0xED5A7E85u, 0xFDA0B80Bu,
+  0x8E41ADE9u, 0xFBEBC27Du, 0x14588F13u, 0xBE847307u, 0xB1D21964u, 0x7AE6B31Cu, 0x596EB2D8u, 0xAE258FC8u,
+  0xDE469FBDu, 0x99A05FE3u, 0x6FCA5F8Eu, 0xD9AEF3BBu, 0x8AEC23D6u, 0x80043BEEu, 0x25DE7BB9u, 0x480D5854u,
+  0xADA72CCCu, 0x20054AE9u, 0xAF561AA7u, 0x9A10AE6Au, 0xD910F7FFu, 0x28069DA4u, 0x1B2BA151u, 0x8094DA04u,
+  0x87AA9AFFu, 0x79042286u, 0x90FB44D2u, 0xF05D0842u, 0xA99541BFu, 0x57452B28u, 0x353A1607u, 0xAC744A53u,
+  0xD3FA922Fu, 0x2D1675F2u, 0x42889B89u, 0x97915CE8u, 0x847C9B5Du, 0x7C2E09B7u, 0x69956135u, 0xFEBADA11u,
+  0xA59BC234u, 0xDB398C25u, 0x43FAB983u, 0x7E699095u, 0xCF02B2C2u, 0x1207EF2Eu, 0x94F967E4u, 0x5E03F4BBu,
+  0x8161AFB9u, 0x4B44F57Du, 0x1D1BE0EEu, 0xBAC278F5u, 0xA1BA1BA7u, 0x9E1632DCu, 0x6462D92Au, 0x69731732u,
+  0xCA28A291u, 0x859BBF93u, 0x7D7B8F75u, 0x03CFDCFEu, 0xFCB2CB35u, 0xE702AF78u, 0x5CDA7352u, 0x44C3D43Eu,
+  0x9DEFBF01u, 0xB061ADABu, 0x3A088813u, 0x6AFA64A7u, 0xC56BAEC2u, 0x1C7A1916u, 0x088AAA18u, 0x45B8FDD0u,
+  0xF6C69A72u, 0xA3989F5Bu, 0x8AAD549Eu, 0x57273D45u, 0x9A3C2087u, 0xA63F6399u, 0x36AC54E2u, 0xF678864Bu,
+  0xC0CB28A9u, 0x8FCF3C7Fu, 0x84576A1Bu, 0xB416A7DDu, 0xF0FDF2D3u, 0xF3C30B9Fu, 0x656D44A2u, 0xA11C51D5u,
+  0x969EB7C4u, 0x7859E743u, 0x9F644AE5u, 0xA4B1B325u, 0xBC4665B5u, 0x96706114u, 0x873D5D9Fu, 0x0DDE1FEEu,
+  0xEB57FF22u, 0xFC0C7959u, 0xA90CB506u, 0xD155A7EAu, 0x9316FF75u, 0xDD87CBD8u, 0x09A7F124u, 0x42D588F2u,
+  0xB7DCBF53u, 0x54E9BECEu, 0x0C11ED6Du, 0x538AEB2Fu, 0xE5D3EF28u, 0x2A242E81u, 0x8F1668C8u, 0xA86DA5FAu,
+  0x8FA47579u, 0x1A569D10u, 0xF96E017Du, 0x694487BCu, 0xB38D92D7u, 0x60EC4455u, 0x37C981DCu, 0xC395A9ACu,
+  0xE070F78Du, 0x3927556Au, 0x85BBE253u, 0xF47B1417u, 0x8C469AB8u, 0x43B89562u, 0x93956D74u, 0x78CCEC8Eu,
+  0xAF584166u, 0x54A6BABBu, 0x387AC8D1u, 0x970027B2u, 0xDB2E51BFu, 0xE9D0696Au, 0x06997B05u, 0xFCC0319Eu,
+  0x88FCF317u, 0xF22241E2u, 0x441FECE3u, 0xBDF81F03u, 0xAB3C2FDDu, 0xEEAAD25Au, 0xD527E81Cu, 0xAD7626C3u,
+  0xD60B3BD5u, 0x6A5586F1u, 0x8A71E223u, 0xD8D3B074u, 0x85C70565u, 0x62757456u, 0xF6872D56u, 0x67844E49u,
+  0xA738C6BEu, 0xBB12D16Cu, 0xB428F8ACu, 0x016561DBu, 0xD106F86Eu, 0x69D785C7u, 0xE13336D7u, 0x01BEBA52u,
+  0x82A45B45u, 0x0226B39Cu, 0xECC00246u, 0x61173473u, 0xA34D7216u, 0x42B06084u, 0x27F002D7u, 0xF95D0190u,
+  0xCC20CE9Bu, 0xD35C78A5u, 0x31EC038Du, 0xF7B441F4u, 0xFF290242u, 0xC83396CEu, 0x7E670471u, 0x75A15271u,
+  0x9F79A169u, 0xBD203E41u, 0x0F0062C6u, 0xE984D386u, 0xC75809C4u, 0x2C684DD1u, 0x52C07B78u, 0xA3E60868u,
+  0xF92E0C35u, 0x37826145u, 0xA7709A56u, 0xCCDF8A82u, 0x9BBCC7A1u, 0x42B17CCBu, 0x88A66076u, 0x400BB691u,
+  0xC2ABF989u, 0x935DDBFEu, 0x6ACFF893u, 0xD00EA435u, 0xF356F7EBu, 0xF83552FEu, 0x0583F6B8u, 0xC4124D43u,
+  0x98165AF3u, 0x7B2153DEu, 0xC3727A33u, 0x7A8B704Au, 0xBE1BF1B0u, 0x59E9A8D6u, 0x744F18C0u, 0x592E4C5Cu,
+  0xEDA2EE1Cu, 0x7064130Cu, 0x1162DEF0u, 0x6F79DF73u, 0x9485D4D1u, 0xC63E8BE7u, 0x8ADDCB56u, 0x45AC2BA8u,
+  0xB9A74A06u, 0x37CE2EE1u, 0x6D953E2Bu, 0xD7173692u, 0xE8111C87u, 0xC5C1BA99u, 0xC8FA8DB6u, 0xCCDD0437u,
+  0x910AB1D4u, 0xDB9914A0u, 0x1D9C9892u, 0x400A22A2u, 0xB54D5E4Au, 0x127F59C8u, 0x2503BEB6u, 0xD00CAB4Bu,
+  0xE2A0B5DCu, 0x971F303Au, 0x2E44AE64u, 0x840FD61Du, 0x8DA471A9u, 0xDE737E24u, 0x5CEAECFEu, 0xD289E5D2u,
+  0xB10D8E14u, 0x56105DADu, 0x7425A83Eu, 0x872C5F47u, 0xDD50F199u, 0x6B947518u, 0xD12F124Eu, 0x28F77719u,
+  0x8A5296FFu, 0xE33CC92Fu, 0x82BD6B70u, 0xD99AAA6Fu, 0xACE73CBFu, 0xDC0BFB7Bu, 0x636CC64Du, 0x1001550Bu,
+  0xD8210BEFu, 0xD30EFA5Au, 0x3C47F7E0u, 0x5401AA4Eu, 0x8714A775u, 0xE3E95C78u, 0x65ACFAECu, 0x34810A71u,
+  0xA8D9D153u, 0x5CE3B396u, 0x7F1839A7u, 0x41A14D0Du, 0xD31045A8u, 0x341CA07Cu, 0x1EDE4811u, 0x1209A050u,
+  0x83EA2B89u, 0x2091E44Du, 0x934AED0Au, 0xAB460432u, 0xA4E4B66Bu, 0x68B65D60u, 0xF81DA84Du, 0x5617853Fu,
+  0xCE1DE406u, 0x42E3F4B9u, 0x36251260u, 0xAB9D668Eu, 0x80D2AE83u, 0xE9CE78F3u, 0xC1D72B7Cu, 0x6B426019u,
+  0xA1075A24u, 0xE4421730u, 0xB24CF65Bu, 0x8612F81Fu, 0xC94930AEu, 0x1D529CFCu, 0xDEE033F2u, 0x6797B627u,
+  0xFB9B7CD9u, 0xA4A7443Cu, 0x169840EFu, 0x017DA3B1u, 0x9D412E08u, 0x06E88AA5u, 0x8E1F2895u, 0x60EE864Eu,
+  0xC491798Au, 0x08A2AD4Eu, 0xF1A6F2BAu, 0xB92A27E2u, 0xF5B5D7ECu, 0x8ACB58A2u, 0xAE10AF69u, 0x6774B1DBu,
+  0x9991A6F3u, 0xD6BF1765u, 0xACCA6DA1u, 0xE0A8EF29u, 0xBFF610B0u, 0xCC6EDD3Fu, 0x17FD090Au, 0x58D32AF3u,
+  0xEFF394DCu, 0xFF8A948Eu, 0xDDFC4B4Cu, 0xEF07F5B0u, 0x95F83D0Au, 0x1FB69CD9u, 0x4ABDAF10u, 0x1564F98Eu,
+  0xBB764C4Cu, 0xA7A4440Fu, 0x9D6D1AD4u, 0x1ABE37F1u, 0xEA53DF5Fu, 0xD18D5513u, 0x84C86189u, 0x216DC5EDu,
+  0x92746B9Bu, 0xE2F8552Cu, 0x32FD3CF5u, 0xB4E49BB4u, 0xB7118682u, 0xDBB66A77u, 0x3FBC8C33u, 0x221DC2A1u,
+  0xE4D5E823u, 0x92A40515u, 0x0FABAF3Fu, 0xEAA5334Au, 0x8F05B116u, 0x3BA6832Du, 0x29CB4D87u, 0xF2A7400Eu,
+  0xB2C71D5Bu, 0xCA9023F8u, 0x743E20E9u, 0xEF511012u, 0xDF78E4B2u, 0xBD342CF6u, 0x914DA924u, 0x6B255416u,
+  0x8BAB8EEFu, 0xB6409C1Au, 0x1AD089B6u, 0xC2F7548Eu, 0xAE9672ABu, 0xA3D0C320u, 0xA184AC24u, 0x73B529B1u,
+  0xDA3C0F56u, 0x8CC4F3E8u, 0xC9E5D72Du, 0x90A2741Eu, 0x88658996u, 0x17FB1871u, 0x7E2FA67Cu, 0x7A658892u,
+  0xAA7EEBFBu, 0x9DF9DE8Du, 0xDDBB901Bu, 0x98FEEAB7u, 0xD51EA6FAu, 0x85785631u, 0x552A7422u, 0x7F3EA565u,
+  0x8533285Cu, 0x936B35DEu, 0xD53A8895u, 0x8F87275Fu, 0xA67FF273u, 0xB8460356u, 0x8A892ABAu, 0xF368F137u,
+  0xD01FEF10u, 0xA657842Cu, 0x2D2B7569u, 0xB0432D85u, 0x8213F56Au, 0x67F6B29Bu, 0x9C3B2962u, 0x0E29FC73u,
+  0xA298F2C5u, 0x01F45F42u, 0x8349F3BAu, 0x91B47B8Fu, 0xCB3F2F76u, 0x42717713u, 0x241C70A9u, 0x36219A73u,
+  0xFE0EFB53u, 0xD30DD4D7u, 0xED238CD3u, 0x83AA0110u, 0x9EC95D14u, 0x63E8A506u, 0xF4363804u, 0x324A40AAu,
+  0xC67BB459u, 0x7CE2CE48u, 0xB143C605u, 0x3EDCD0D5u, 0xF81AA16Fu, 0xDC1B81DAu, 0xDD94B786u, 0x8E94050Au,
+  0x9B10A4E5u, 0xE9913128u, 0xCA7CF2B4u, 0x191C8326u, 0xC1D4CE1Fu, 0x63F57D72u, 0xFD1C2F61u, 0x1F63A3F0u,
+  0xF24A01A7u, 0x3CF2DCCFu, 0xBC633B39u, 0x673C8CECu, 0x976E4108u, 0x8617CA01u, 0xD5BE0503u, 0xE085D813u,
+  0xBD49D14Au, 0xA79DBC82u, 0x4B2D8644u, 0xD8A74E18u, 0xEC9C459Du, 0x51852BA2u, 0xDDF8E7D6u, 0x0ED1219Eu,
+  0x93E1AB82u, 0x52F33B45u, 0xCABB90E5u, 0xC942B503u, 0xB8DA1662u, 0xE7B00A17u, 0x3D6A751Fu, 0x3B936243u,
+  0xE7109BFBu, 0xA19C0C9Du, 0x0CC51267u, 0x0A783AD4u, 0x906A617Du, 0x450187E2u, 0x27FB2B80u, 0x668B24C5u,
+  0xB484F9DCu, 0x9641E9DAu, 0xB1F9F660u, 0x802DEDF6u, 0xE1A63853u, 0xBBD26451u, 0x5E7873F8u, 0xA0396973u,
+  0x8D07E334u, 0x55637EB2u, 0xDB0B487Bu, 0x6423E1E8u, 0xB049DC01u, 0x6ABC5E5Fu, 0x91CE1A9Au, 0x3D2CDA62u,
+  0xDC5C5301u, 0xC56B75F7u, 0x7641A140u, 0xCC7810FBu, 0x89B9B3E1u, 0x1B6329BAu, 0xA9E904C8u, 0x7FCB0A9Du,
+  0xAC2820D9u, 0x623BF429u, 0x546345FAu, 0x9FBDCD44u, 0xD732290Fu, 0xBACAF133u, 0xA97C1779u, 0x47AD4095u,
+  0x867F59A9u, 0xD4BED6C0u, 0x49ED8EABu, 0xCCCC485Du, 0xA81F3014u, 0x49EE8C70u, 0x5C68F256u, 0xBFFF5A74u,
+  0xD226FC19u, 0x5C6A2F8Cu, 0x73832EECu, 0x6FFF3111u, 0x83585D8Fu, 0xD9C25DB7u, 0xC831FD53u, 0xC5FF7EABu,
+  0xA42E74F3u, 0xD032F525u, 0xBA3E7CA8u, 0xB77F5E55u, 0xCD3A1230u, 0xC43FB26Fu, 0x28CE1BD2u, 0xE55F35EBu,
+  0x80444B5Eu, 0x7AA7CF85u, 0x7980D163u, 0xCF5B81B3u, 0xA0555E36u, 0x1951C366u, 0xD7E105BCu, 0xC332621Fu,
+  0xC86AB5C3u, 0x9FA63440u, 0x8DD9472Bu, 0xF3FEFAA7u, 0xFA856334u, 0x878FC150u, 0xB14F98F6u, 0xF0FEB951u,
+  0x9C935E00u, 0xD4B9D8D2u, 0x6ED1BF9Au, 0x569F33D3u, 0xC3B83581u, 0x09E84F07u, 0x0A862F80u, 0xEC4700C8u,
+  0xF4A642E1u, 0x4C6262C8u, 0xCD27BB61u, 0x2758C0FAu, 0x98E7E9CCu, 0xCFBD7DBDu, 0x8038D51Cu, 0xB897789Cu,
+  0xBF21E440u, 0x03ACDD2Cu, 0xE0470A63u, 0xE6BD56C3u, 0xEEEA5D50u, 0x04981478u, 0x1858CCFCu, 0xE06CAC74u,
+  0x95527A52u, 0x02DF0CCBu, 0x0F37801Eu, 0x0C43EBC8u, 0xBAA718E6u, 0x8396CFFDu, 0xD3056025u, 0x8F54E6BAu,
+  0xE950DF20u, 0x247C83FDu, 0x47C6B82Eu, 0xF32A2069u, 0x91D28B74u, 0x16CDD27Eu, 0x4CDC331Du, 0x57FA5441u,
+  0xB6472E51u, 0x1C81471Du, 0xE0133FE4u, 0xADF8E952u, 0xE3D8F9E5u, 0x63A198E5u, 0x58180FDDu, 0xD97723A6u,
+  0x8E679C2Fu, 0x5E44FF8Fu, 0x570F09EAu, 0xA7EA7648u
+};
+    #define efjson__MIN_POWER_OF_TEN (-342)
+    #define efjson__MAX_POWER_OF_TEN 308
+    #define efjson__u64(hi, lo) (efjson_cast(efjsonUint64, hi) << 32 | (lo))
+    #define efjson__DOUBLE_INFINITY (efjson_cast(efjsonUint64, 0x7FF) << 52)
+    #define efjson__DOUBLE_NAN (efjson_cast(efjsonUint64, 0xFFF) << 51)
+
+/* return the high 64 bits of `a * b`, and store the low 64 bits in `*low` */
+EFJSON_PRIVATE efjsonUint64 efjson__mul128(efjsonUint64 a, efjsonUint64 b, efjsonUint64* low) {
+    #if defined(__SIZEOF_INT128__) && !defined(UL_PEDANTIC)
+  __extension__ unsigned __int128 r = efjson_cast(unsigned __int128, a) * b;
+  *low = efjson_cast(efjsonUint64, r);
+  return efjson_cast(efjsonUint64, r >> 64);
+    #else
+  efjsonUint64 a0 = a & 0xFFFFFFFFu, a1 = a >> 32, b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+  efjsonUint64 p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  efjsonUint64 mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+  *low = (mid << 32) | (p00 & 0xFFFFFFFFu);
+  return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    #endif
+}
+EFJSON_PRIVATE int efjson__countLeadingZero(efjsonUint64 x) {
+    #if !defined(UL_PEDANTIC) && (defined(__GNUC__) || defined(__clang__))
+  return sizeof(efjsonUint64) == sizeof(unsigned long) ? __builtin_clzl(efjson_cast(unsigned long, x))
+                                                       : __builtin_clzll(x);
+    #else
+  int n = 0;
+  while(!(x >> 63)) {
+    x <<= 1;
+    ++n;
+  }
+  return n;
+    #endif
+}
+
+/**
+ * Eisel-Lemire algorithm: the bits of the double nearest to `w * 10^q` (`w` != 0).
+ * It's exact for every `w` < 2^64, see "Number Parsing at a Gigabyte per Second" (Daniel Lemire, 2021).
+ */
+EFJSON_PRIVATE efjsonUint64 efjson__eiselLemire(efjsonUint64 w, long q) {
+  efjsonUint64 high, low, high2, low2, mantissa;
+  const efjsonUint32* p;
+  int lz, upperbit, shift;
+  long power2;
+  if(q < efjson__MIN_POWER_OF_TEN) return 0;
+  if(q > efjson__MAX_POWER_OF_TEN) return efjson__DOUBLE_INFINITY;
+
+  lz = efjson__countLeadingZero(w);
+  w <<= lz;
+  p = efjson__POWER_OF_FIVE + (q - efjson__MIN_POWER_OF_TEN) * 4;
+  high = efjson__mul128(w, efjson__u64(p[0], p[1]), &low);
+  if((high & 0x1FF) == 0x1FF) { /* the lower bits may be inexact */
+    high2 = efjson__mul128(w, efjson__u64(p[2], p[3]), &low2);
+    low += high2;
+    if(high2 > low) ++high;
+  }
+  upperbit = efjson_cast(int, high >> 63);
+  shift = upperbit + 64 - 52 - 3;
+  mantissa = high >> shift;
+  /* floor(log2(10^q)) + 63 - (-1023) */
+  power2 = (((152170L + 65536L) * q) >> 16) + 63 + upperbit - lz + 1023;
+
+  if(power2 <= 0) { /* subnormal */
+    if(-power2 + 1 >= 64) return 0;
+    mantissa >>= -power2 + 1;
+    mantissa += mantissa & 1;
+    return mantissa >> 1; /* it carries into the exponent if rounded up to the smallest normal */
+  }
+  /* exactly halfway, round to even */
+  if(low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == high)
+    mantissa &= ~efjson_cast(efjsonUint64, 1);
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+  if(mantissa >= (efjson_cast(efjsonUint64, 2) << 52)) {
+    mantissa = efjson_cast(efjsonUint64, 1) << 52;
+    ++power2;
+  }
+  mantissa &= ~(efjson_cast(efjsonUint64, 1) << 52);
+  if(power2 >= 0x7FF) return efjson__DOUBLE_INFINITY;
+  return mantissa | efjson_cast(efjsonUint64, power2) << 52;
+}
+EFJSON_PRIVATE double efjson__bitsToDouble(efjsonUint64 bits) {
+  double ret;
+  memcpy(&ret, &bits, sizeof(double));
+  return ret;
+}
+    #if (defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0) \
+      || (defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0)
+EFJSON_PRIVATE const double efjson__EXACT_POWER_OF_TEN[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                              1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                              1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    #endif
+/**
+ * Convert `w * 10^q` to double, `truncated` means that the exact value is in (w, w+1) * 10^q.
+ * @return 0 if the rounding can't be decided.
+ */
+EFJSON_PRIVATE int efjson__decimalToDouble(efjsonUint64 w, long q, int truncated, double* value) {
+  efjsonUint64 bits;
+  if(w == 0) {
+    *value = 0.0;
+    return 1;
+  }
+    #if (defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0) \
+      || (defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0)
+  /* Clinger's fast path: both operands are exact */
+  if(!truncated && q >= -22 && q <= 22 && w <= (efjson_cast(efjsonUint64, 1) << 53)) {
+    *value = efjson_cast(double, w);
+    if(q < 0) *value /= efjson__EXACT_POWER_OF_TEN[-q];
+    else *value *= efjson__EXACT_POWER_OF_TEN[q];
+    return 1;
+  }
+    #endif
+  bits = efjson__eiselLemire(w, q);
+  *value = efjson__bitsToDouble(bits);
+  return !truncated || bits == efjson__eiselLemire(w + 1, q);
+}
+  #endif /* EFJSON_CONF_NUMBER_VALUE */
+
+
 /******************************
  * Internal state
  ******************************/
@@ -1649,8 +2510,14 @@ EFJSON_PRIVATE const efjsonUint8 efjson__LOCATION_TABLE[] = {
 
 enum {
   efjsonFlag__MeetCr = 0x1,
-  efjsonFlag__SingleQuote = 0x2
+  efjsonFlag__SingleQuote = 0x2,
+  efjsonFlag__Limited = 0x4
 };
+  #if EFJSON_CONF_LIMITS
+    #define efjson__isLimited(parser) ((parser)->flag & efjsonFlag__Limited)
+  #else
+    #define efjson__isLimited(parser) 0
+  #endif
 
 
 EFJSON_PRIVATE const efjsonUint8 efjson__LITERAL_NULL[] = { 0x6E, 0x75, 0x6C, 0x6C } /* "null" */;
@@ -1693,6 +2560,88 @@ enum {
   efjsonNumberExponent__AFTER_DIGIT = 2
 };
 
+  #if EFJSON_CONF_NUMBER_VALUE
+enum {
+  efjsonNumberFlag__Negative = 0x1,
+  efjsonNumberFlag__NegativeExponent = 0x2,
+  /** non-zero digits are dropped */
+  efjsonNumberFlag__Truncated = 0x4,
+  /** hexadecimal/octal/binary integer */
+  efjsonNumberFlag__Binary = 0x8,
+  efjsonNumberFlag__Infinity = 0x10,
+  efjsonNumberFlag__NaN = 0x20,
+  /** with fraction or exponent part */
+  efjsonNumberFlag__Float = 0x40
+};
+    /* more significant digits may not fit in `mantissa` */
+    #define efjson__MAX_DIGITS 19
+    /* bound of `scale` and `exponent`, the value is 0 or infinity far before it */
+    #define efjson__MAX_SCALE 0x4000000L
+
+    #define efjson__numberStart(parser, flag)                                                                     \
+      ((parser)->mantissa = 0, (parser)->scale = (parser)->exponent = 0, (parser)->digits = 0,                    \
+       (parser)->numberFlag = efjson_cast(efjsonUint8, flag))
+    #define efjson__numberFlag(parser, flag) ((parser)->numberFlag |= efjson_cast(efjsonUint8, flag))
+    #define efjson__numberPower(parser) \
+      ((parser)->scale                \
+       + ((parser)->numberFlag & efjsonNumberFlag__NegativeExponent ? -(parser)->exponent : (parser)->exponent))
+    #define efjson__numberDigit(parser, d, fraction) efjsonStreamParser__numberDigit(parser, d, fraction)
+    #define efjson__numberRadixDigit(parser, d, bits) efjsonStreamParser__numberRadixDigit(parser, d, bits)
+    #define efjson__numberExponent(parser, d)                                                                    \
+      ((parser)->exponent = (parser)->exponent < efjson__MAX_SCALE ? (parser)->exponent * 10 + efjson_cast(long, d) \
+                                                                   : efjson__MAX_SCALE)
+EFJSON_PRIVATE void efjsonStreamParser__numberDigit(efjsonStreamParser* parser, efjsonUint32 d, int fraction) {
+  if(ul_likely(parser->digits < efjson__MAX_DIGITS)) {
+    if(ul_likely(parser->mantissa != 0 || d != 0)) {
+      parser->mantissa = parser->mantissa * 10 + d;
+      ++parser->digits;
+      parser->scale -= fraction;
+    } else if(fraction && parser->scale > -efjson__MAX_SCALE) {
+      --parser->scale; /* leading zeros of fraction */
+    }
+  } else {
+    if(d != 0) parser->numberFlag |= efjsonNumberFlag__Truncated;
+    if(!fraction && parser->scale < efjson__MAX_SCALE) ++parser->scale;
+  }
+}
+    #if EFJSON_CONF_EXTENDED_JSON
+EFJSON_PRIVATE void efjsonStreamParser__numberRadixDigit(efjsonStreamParser* parser, efjsonUint32 d, int bits) {
+  if(ul_likely((parser->mantissa >> (64 - bits)) == 0)) {
+    parser->mantissa = parser->mantissa << bits | d;
+  } else {
+    if(d != 0) parser->numberFlag |= efjsonNumberFlag__Truncated;
+    if(parser->scale < efjson__MAX_SCALE) parser->scale += bits;
+  }
+}
+    #endif /* EFJSON_CONF_EXTENDED_JSON */
+  #else  /* !EFJSON_CONF_NUMBER_VALUE */
+    #define efjson__numberStart(parser, flag) ((void)0)
+    #define efjson__numberFlag(parser, flag) ((void)0)
+    #define efjson__numberDigit(parser, d, fraction) ((void)0)
+    #define efjson__numberRadixDigit(parser, d, bits) ((void)0)
+    #define efjson__numberExponent(parser, d) ((void)0)
+  #endif /* EFJSON_CONF_NUMBER_VALUE */
+
+  #if EFJSON_CONF_NUMBER_SPAN
+/* private bits of `spanFlag`, above `efjsonNumberFlag_*` */
+enum {
+  efjsonSpanFlag__Sign = 0x100,
+  efjsonSpanFlag__Point = 0x200,
+  efjsonSpanFlag__Exponent = 0x400,
+  efjsonSpanFlag__ExponentSign = 0x800
+};
+    #define efjson__spanStart(parser, flag) \
+      ((parser)->numberBegin = (parser)->position, (parser)->spanFlag = efjson_cast(efjsonUint16, flag))
+    #define efjson__spanFlag(parser, flag) ((parser)->spanFlag |= efjson_cast(efjsonUint16, flag))
+    #define efjson__spanMark(parser, field, flag) ((parser)->field = (parser)->position, efjson__spanFlag(parser, flag))
+    #define efjson__spanEnd(parser) ((parser)->numberEnd = (parser)->position)
+  #else /* !EFJSON_CONF_NUMBER_SPAN */
+    #define efjson__spanStart(parser, flag) ((void)0)
+    #define efjson__spanFlag(parser, flag) ((void)0)
+    #define efjson__spanMark(parser, field, flag) ((void)0)
+    #define efjson__spanEnd(parser) ((void)0)
+  #endif /* EFJSON_CONF_NUMBER_SPAN */
+
   #if EFJSON_CONF_COMPRESS_STACK
     #define efjson__stackLen(n) efjson_cast(efjsonStackLength, (n) >> 3)
     #define efjson__bitshl(v, n) efjson_cast(efjsonUint8, (v) << (n))
@@ -1791,6 +2740,7 @@ EFJSON_PRIVATE void efjsonStreamParser__handleEof(efjsonStreamParser* parser, ef
 EFJSON_PRIVATE void efjsonStreamParser__handleNumberSeparator(
   efjsonStreamParser* parser, efjsonUint32 u, efjsonToken* token
 ) {
+  efjson__spanEnd(parser);
   parser->state = efjsonVal__EMPTY;
   parser->location = efjson__nextLocation(parser->location);
   if(ul_unlikely(u == 0x00)) {
@@ -2077,6 +3027,8 @@ EFJSON_PRIVATE void efjsonStreamParser__handleEmpty(efjsonStreamParser* parser,
         parser->state = efjsonVal__NUMBER;
         parser->substate = efjsonNumberState__ONLY_SIGN;
         token->type = efjsonType_NUMBER_INTEGER_SIGN;
+        efjson__numberStart(parser, u == 0x2D ? efjsonNumberFlag__Negative : 0);
+        efjson__spanStart(parser, efjsonSpanFlag__Sign | (u == 0x2D ? efjsonNumberFlag_NEGATIVE : 0));
         break;
       case 0x30 /* '0' */:
       case 0x31 /* '1' */:
@@ -2091,6 +3043,9 @@ EFJSON_PRIVATE void efjsonStreamParser__handleEmpty(efjsonStreamParser* parser,
         parser->state = efjsonVal__NUMBER;
         parser->substate = (u != '0');
         token->type = efjsonType_NUMBER_INTEGER_DIGIT;
+        efjson__numberStart(parser, 0);
+        efjson__numberDigit(parser, u - 0x30, 0);
+        efjson__spanStart(parser, 0);
         break;
       case 0x2E /* '.' */:
   #if EFJSON_CONF_EXTENDED_JSON
@@ -2098,6 +3053,9 @@ EFJSON_PRIVATE void efjsonStreamParser__handleEmpty(efjsonStreamParser* parser,
           parser->state = efjsonVal__NUMBER_FRACTION;
           parser->substate = efjsonNumberFraction__EMPTY_INTEGER;
           token->type = efjsonType_NUMBER_FRACTION_START;
+          efjson__numberStart(parser, efjsonNumberFlag__Float);
+          efjson__spanStart(parser, 0);
+          efjson__spanMark(parser, numberPoint, efjsonSpanFlag__Point);
         } else
   #endif /* EFJSON_CONF_EXTENDED_JSON */
           token->extra = efjsonError_EMPTY_INTEGER_PART;
@@ -2108,6 +3066,8 @@ EFJSON_PRIVATE void efjsonStreamParser__handleEmpty(efjsonStreamParser* parser,
           parser->state = efjsonVal__NUMBER_NAN;
           parser->substate = 1;
           token->type = efjsonType_NUMBER_NAN;
+          efjson__numberStart(parser, efjsonNumberFlag__NaN);
+          efjson__spanStart(parser, efjsonNumberFlag_NAN);
         } else
   #endif /* EFJSON_CONF_EXTENDED_JSON */
           token->extra = efjsonError_UNEXPECTED_IN_NUMBER;
@@ -2118,6 +3078,8 @@ EFJSON_PRIVATE void efjsonStreamParser__handleEmpty(efjsonStreamParser* parser,
           parser->state = efjsonVal__NUMBER_INFINITY;
           parser->substate = 1;
           token->type = efjsonType_NUMBER_INFINITY;
+          efjson__numberStart(parser, efjsonNumberFlag__Infinity);
+          efjson__spanStart(parser, efjsonNumberFlag_INFINITY);
         } else
   #endif /* EFJSON_CONF_EXTENDED_JSON */
           token->extra = efjsonError_UNEXPECTED_IN_NUMBER;
@@ -2410,12 +3372,14 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
       else {
         if(parser->substate == efjsonNumberState__ONLY_SIGN) parser->substate = efjsonNumberState__ZERO;
         token.type = efjsonType_NUMBER_INTEGER_DIGIT;
+        efjson__numberDigit(parser, 0, 0);
       }
     } else if(u >= 0x31 /* '1' */ && u <= 0x39 /* '9' */) {
       if(ul_unlikely(parser->substate == efjsonNumberState__ZERO)) token.extra = efjsonError_LEADING_ZERO_FORBIDDEN;
       else {
         if(parser->substate == efjsonNumberState__ONLY_SIGN) parser->substate = efjsonNumberState__NON_LEADING_ZERO;
         token.type = efjsonType_NUMBER_INTEGER_DIGIT;
+        efjson__numberDigit(parser, u - 0x30, 0);
       }
     }
   #if EFJSON_CONF_EXTENDED_JSON
@@ -2429,6 +3393,8 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
                              ? efjsonNumberFraction__EMPTY_INTEGER
                              : efjsonNumberFraction__NOT_YET;
         token.type = efjsonType_NUMBER_FRACTION_START;
+        efjson__numberFlag(parser, efjsonNumberFlag__Float);
+        efjson__spanMark(parser, numberPoint, efjsonSpanFlag__Point);
       }
     } else if(ul_unlikely(parser->substate == efjsonNumberState__ONLY_SIGN)) {
       if((parser->option & efjsonOption_INFINITY) && u == 0x49 /* 'I' */) {
@@ -2436,11 +3402,15 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
         parser->substate = 1;
         token.type = efjsonType_NUMBER_INFINITY;
         token.index = 0;
+        efjson__numberFlag(parser, efjsonNumberFlag__Infinity);
+        efjson__spanFlag(parser, efjsonNumberFlag_INFINITY);
       } else if((parser->option & efjsonOption_NAN) && u == 0x4E /* 'N' */) {
         parser->state = efjsonVal__NUMBER_NAN;
         parser->substate = 1;
         token.type = efjsonType_NUMBER_NAN;
         token.index = 0;
+        efjson__numberFlag(parser, efjsonNumberFlag__NaN);
+        efjson__spanFlag(parser, efjsonNumberFlag_NAN);
       } else token.extra = efjsonError_EMPTY_INTEGER_PART;
     } else {
       if(parser->substate == efjsonNumberState__ZERO) {
@@ -2448,16 +3418,22 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
           parser->state = efjsonVal__NUMBER_HEX;
           parser->substate = 0;
           token.type = efjsonType_NUMBER_HEX_START;
+          efjson__numberFlag(parser, efjsonNumberFlag__Binary);
+          efjson__spanFlag(parser, efjsonNumberFlag_HEXADECIMAL);
           break;
         } else if((parser->option & efjsonOption_OCTAL_INTEGER) && (u == 0x6F /* 'o' */ || u == 0x4F /* 'O' */)) {
           parser->state = efjsonVal__NUMBER_OCT;
           parser->substate = 0;
           token.type = efjsonType_NUMBER_OCT_START;
+          efjson__numberFlag(parser, efjsonNumberFlag__Binary);
+          efjson__spanFlag(parser, efjsonNumberFlag_OCTAL);
           break;
         } else if((parser->option & efjsonOption_BINARY_INTEGER) && (u == 0x62 /* 'b' */ || u == 0x42 /* 'B' */)) {
           parser->state = efjsonVal__NUMBER_BIN;
           parser->substate = 0;
           token.type = efjsonType_NUMBER_BIN_START;
+          efjson__numberFlag(parser, efjsonNumberFlag__Binary);
+          efjson__spanFlag(parser, efjsonNumberFlag_BINARY);
           break;
         }
       }
@@ -2466,6 +3442,8 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
         parser->state = efjsonVal__NUMBER_EXPONENT;
         parser->substate = efjsonNumberExponent__NOT_YET;
         token.type = efjsonType_NUMBER_EXPONENT_START;
+        efjson__numberFlag(parser, efjsonNumberFlag__Float);
+        efjson__spanMark(parser, numberExponent, efjsonSpanFlag__Exponent);
       } else if(ul_likely(efjson__isNumberSeparator(u, parser->option & efjsonOption_JSON5_WHITESPACE)))
         efjsonStreamParser__handleNumberSeparator(parser, u, &token);
       else token.extra = efjsonError_UNEXPECTED_IN_NUMBER;
@@ -2477,10 +3455,14 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
       parser->state = efjsonVal__NUMBER_FRACTION;
       parser->substate = efjsonNumberFraction__NOT_YET;
       token.type = efjsonType_NUMBER_FRACTION_START;
+      efjson__numberFlag(parser, efjsonNumberFlag__Float);
+      efjson__spanMark(parser, numberPoint, efjsonSpanFlag__Point);
     } else if(u == 0x65 /* 'e' */ || u == 0x45 /* 'E' */) {
       parser->state = efjsonVal__NUMBER_EXPONENT;
       parser->substate = efjsonNumberExponent__NOT_YET;
       token.type = efjsonType_NUMBER_EXPONENT_START;
+      efjson__numberFlag(parser, efjsonNumberFlag__Float);
+      efjson__spanMark(parser, numberExponent, efjsonSpanFlag__Exponent);
     } else if(ul_likely(efjson__isNumberSeparator(u))) {
       efjsonStreamParser__handleNumberSeparator(parser, u, &token);
     } else token.extra = efjsonError_UNEXPECTED_IN_NUMBER;
@@ -2490,6 +3472,7 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
     if(u >= 0x30 /* '0' */ && u <= 0x39 /* '9' */) {
       parser->substate = efjsonNumberFraction__Digit;
       token.type = efjsonType_NUMBER_FRACTION_DIGIT;
+      efjson__numberDigit(parser, u - 0x30, 1);
     }
   #if EFJSON_CONF_EXTENDED_JSON
     else if(parser->substate != efjsonNumberFraction__Digit && !(parser->option & efjsonOption_EMPTY_FRACTION)) {
@@ -2500,6 +3483,7 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
       parser->state = efjsonVal__NUMBER_EXPONENT;
       parser->substate = efjsonNumberExponent__NOT_YET;
       token.type = efjsonType_NUMBER_EXPONENT_START;
+      efjson__spanMark(parser, numberExponent, efjsonSpanFlag__Exponent);
     } else if(ul_likely(efjson__isNumberSeparator(u, parser->option & efjsonOption_JSON5_WHITESPACE)))
       efjsonStreamParser__handleNumberSeparator(parser, u, &token);
     else
@@ -2510,6 +3494,7 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
       parser->state = efjsonVal__NUMBER_EXPONENT;
       parser->substate = efjsonNumberExponent__NOT_YET;
       token.type = efjsonType_NUMBER_EXPONENT_START;
+      efjson__spanMark(parser, numberExponent, efjsonSpanFlag__Exponent);
     } else if(ul_likely(efjson__isNumberSeparator(u))) {
       efjsonStreamParser__handleNumberSeparator(parser, u, &token);
     } else
@@ -2521,10 +3506,15 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
       if(parser->substate == efjsonNumberExponent__NOT_YET) {
         parser->substate = efjsonNumberExponent__AFTER_SIGN;
         token.type = efjsonType_NUMBER_EXPONENT_SIGN;
+        if(u == 0x2D /* '-' */) efjson__numberFlag(parser, efjsonNumberFlag__NegativeExponent);
+        efjson__spanFlag(
+          parser, efjsonSpanFlag__ExponentSign | (u == 0x2D /* '-' */ ? efjsonNumberFlag_NEGATIVE_EXPONENT : 0)
+        );
       } else token.extra = efjsonError_UNEXPECTED_IN_NUMBER;
     } else if(u >= 0x30 /* '0' */ && u <= 0x39 /* '9' */) {
       parser->substate = efjsonNumberExponent__AFTER_DIGIT;
       token.type = efjsonType_NUMBER_EXPONENT_DIGIT;
+      efjson__numberExponent(parser, u - 0x30);
     } else if(parser->substate != efjsonNumberExponent__AFTER_DIGIT) token.extra = efjsonError_EMPTY_EXPONENT_PART;
   #if EFJSON_CONF_EXTENDED_JSON
     else if(ul_likely(efjson__isNumberSeparator(u, parser->option & efjsonOption_JSON5_WHITESPACE)))
@@ -2541,6 +3531,7 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
     if(ul_likely(efjson__isHexDigit(u))) {
       parser->substate = 1;
       token.type = efjsonType_NUMBER_HEX;
+      efjson__numberRadixDigit(parser, u <= 0x39 /* '9' */ ? u - 0x30 : (u | 0x20) - 0x61 /* 'a' */ + 10, 4);
     } else if(u == 0x2E /* '.' */) token.extra = efjsonError_FRACTION_NOT_ALLOWED;
     else if(parser->substate == 0) token.extra = efjsonError_EMPTY_INTEGER_PART;
     else if(ul_likely(efjson__isNumberSeparator(u, parser->option & efjsonOption_JSON5_WHITESPACE)))
@@ -2551,6 +3542,7 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
     if(ul_likely(u >= 0x30 /* '0' */ && u <= 0x37 /* '7' */)) {
       parser->substate = 1;
       token.type = efjsonType_NUMBER_OCT;
+      efjson__numberRadixDigit(parser, u - 0x30, 3);
     } else if(u == 0x65 /* 'e' */ || u == 0x45 /* 'E' */) token.extra = efjsonError_EXPONENT_NOT_ALLOWED;
     else if(u == 0x2E /* '.' */) token.extra = efjsonError_FRACTION_NOT_ALLOWED;
     else if(parser->substate == 0) token.extra = efjsonError_EMPTY_INTEGER_PART;
@@ -2562,6 +3554,7 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
     if(ul_likely(u == 0x30 /* '0' */ || u == 0x31 /* '1' */)) {
       parser->substate = 1;
       token.type = efjsonType_NUMBER_BIN;
+      efjson__numberRadixDigit(parser, u - 0x30, 1);
     } else if(u == 0x65 /* 'e' */ || u == 0x45 /* 'E' */) token.extra = efjsonError_EXPONENT_NOT_ALLOWED;
     else if(u == 0x2E /* '.' */) token.extra = efjsonError_FRACTION_NOT_ALLOWED;
     else if(parser->substate == 0) token.extra = efjsonError_EMPTY_INTEGER_PART;
@@ -2668,6 +3661,7 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
           }
     #endif
           parser->state = efjsonVal__IDENTIFIER;
+          token.extra = efjson_cast(efjsonUint16, parser->escape);
         }
       } else token.extra = efjsonError_INVALID_IDENTIFIER_ESCAPE;
     }
@@ -2684,9 +3678,10 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
       break;
     case 1:
       if(ul_likely(u == 0x75 /* 'u' */)) {
-        parser->substate = 1;
-        token.index = 4;
+        parser->substate = 2;
+        token.index = 5;
         token.type = efjsonType_IDENTIFIER_ESCAPE;
+        parser->escape = 0;
       } else token.extra = efjsonError_BAD_IDENTIFIER_ESCAPE;
       break;
     default:
@@ -2718,16 +3713,53 @@ EFJSON_PRIVATE efjsonToken efjsonStreamParser__step(efjsonStreamParser* parser,
   }
   return token;
 }
-  #if EFJSON_CONF_COMPRESS_STACK
-    #undef efjson__bitshl
-    #undef efjson___pushArray
-    #undef efjson___pushObject
-  #endif
-  #undef efjson__stackLen
-  #undef efjson__push
-  #undef efjson__last
-  #undef efjson__nextLocation
-  #undef efjson__isUtf16Surrogate
+
+  #if EFJSON_CONF_LIMITS
+/** `efjsonStreamParser__step` with the limits checked, the token is turned into an error if one is exceeded */
+EFJSON_PRIVATE efjsonToken efjsonStreamParser__stepLimited(efjsonStreamParser* parser, efjsonUint32 u) {
+  const efjsonLimits* limits = &parser->limits;
+  efjsonUint8 state = parser->state, category, error = 0;
+  efjsonPosition length;
+  efjsonToken token;
+  if(limits->maxInput != 0 && parser->position >= limits->maxInput && u != 0) {
+    error = efjsonError_INPUT_TOO_LONG;
+  } else {
+    token = efjsonStreamParser__step(parser, u);
+    category = efjson_cast(efjsonUint8, token.type >> efjson_TOKEN_CATEGORY_SHIFT);
+    if(state == efjsonVal__EMPTY
+       && (token.type == efjsonType_ARRAY_START || token.type == efjsonType_OBJECT_START
+           || (category >= efjsonCategory_NULL && category <= efjsonCategory_NUMBER)
+    #if EFJSON_CONF_EXTENDED_JSON
+           || category == efjsonCategory_IDENTIFIER
+    #endif
+           )) {
+      parser->valueBegin = parser->position;
+      if(limits->maxValues != 0 && ++parser->values > limits->maxValues) error = efjsonError_TOO_MANY_VALUES;
+      else if(limits->maxDepth != 0 && parser->len > limits->maxDepth) error = efjsonError_TOO_DEEP;
+    }
+    length = parser->position - parser->valueBegin; /* of the value before `u` */
+    if(category == efjsonCategory_STRING) {
+      if(limits->maxStringLength != 0 && length > limits->maxStringLength && token.type != efjsonType_STRING_END)
+        error = efjsonError_STRING_TOO_LONG;
+    #if EFJSON_CONF_EXTENDED_JSON
+    } else if(category == efjsonCategory_IDENTIFIER) {
+      if(limits->maxStringLength != 0 && length >= limits->maxStringLength) error = efjsonError_STRING_TOO_LONG;
+    #endif
+    } else if(category == efjsonCategory_NUMBER) {
+      if(limits->maxNumberLength != 0 && length >= limits->maxNumberLength) error = efjsonError_NUMBER_TOO_LONG;
+    }
+    if(ul_likely(error == 0)) return token;
+  }
+  memset(&token, 0, sizeof(efjsonToken));
+  token.type = efjsonType_ERROR;
+  token.extra = error;
+  return token;
+}
+    #define efjson__step(parser, u) \
+      (efjson__isLimited(parser) ? efjsonStreamParser__stepLimited(parser, u) : efjsonStreamParser__step(parser, u))
+  #else
+    #define efjson__step(parser, u) efjsonStreamParser__step(parser, u)
+  #endif /* EFJSON_CONF_LIMITS */
 
 
 EFJSON_PUBLIC size_t efjsonStreamParser_sizeof(void) {
@@ -2735,20 +3767,39 @@ EFJSON_PUBLIC size_t efjsonStreamParser_sizeof(void) {
 }
 EFJSON_PUBLIC void efjsonStreamParser_init(efjsonStreamParser* parser, efjsonUint32 option) {
   parser->position = parser->line = parser->column = 0;
-  #if EFJSON_CONF_EXTENDED_JSON
-  parser->option = option;
-  #else
+  #if !EFJSON_CONF_EXTENDED_JSON
   efjson_assert(option == 0);
   #endif
+  parser->option = option;
   parser->location = efjsonLoc__ROOT_START;
   parser->state = efjsonVal__EMPTY;
   parser->flag = 0;
   parser->len = 0;
+  #if EFJSON_CONF_NUMBER_VALUE
+  efjson__numberStart(parser, 0);
+  #endif
+  #if EFJSON_CONF_NUMBER_SPAN
+  efjson__spanStart(parser, 0);
+  efjson__spanEnd(parser);
+  #endif
+  #if EFJSON_CONF_LIMITS
+  memset(&parser->limits, 0, sizeof(efjsonLimits));
+  parser->values = parser->valueBegin = 0;
+  #endif
   #if !(EFJSON_CONF_FIXED_STACK > 0)
   parser->cap = 0;
   parser->stack = NULL;
   #endif
 }
+  #if EFJSON_CONF_LIMITS
+EFJSON_PUBLIC void efjsonStreamParser_setLimits(efjsonStreamParser* parser, const efjsonLimits* limits) {
+  parser->limits = *limits;
+  if(limits->maxInput != 0 || limits->maxValues != 0 || limits->maxStringLength != 0
+     || limits->maxNumberLength != 0 || limits->maxDepth != 0)
+    parser->flag |= efjsonFlag__Limited;
+  else parser->flag &= ~efjsonFlag__Limited;
+}
+  #endif /* EFJSON_CONF_LIMITS */
 EFJSON_PUBLIC void(efjsonStreamParser_deinit)(efjsonStreamParser* parser) {
   #if EFJSON_CONF_FIXED_STACK > 0
   (void)parser;
@@ -2845,29 +3896,574 @@ EFJSON_PUBLIC efjsonStreamParser* efjsonStreamParser_newCopy(const efjsonStreamP
 EFJSON_PUBLIC efjsonToken efjsonStreamParser_feedOne(efjsonStreamParser* parser, efjsonUint32 u) {
   efjsonToken token;
   efjsonStreamParser__checkPosition(parser, u, token, return token;);
-  token = efjsonStreamParser__step(parser, u);
+  token = efjson__step(parser, u);
   if(ul_likely(token.type != 0)) {
     efjsonStreamParser__movePosition(parser, u);
   }
   return token;
+}
+  #if EFJSON_CONF_NUMBER_VALUE
+/**
+ * Accept 8 digits of integer or fraction part at once, the value is combined by SWAR.
+ * @return 0 if `src` doesn't start with 8 digits.
+ */
+EFJSON_PRIVATE int efjsonStreamParser__feedEightDigits(
+  efjsonStreamParser* parser, efjsonToken* dest, const efjsonUint32* src
+) {
+  const efjsonUint64 mask = efjson__u64(0xFF, 0xFF);
+  const efjsonUint64 mul1 = efjson__u64(1000000, 100), mul2 = efjson__u64(10000, 1);
+  efjsonUint64 chunk = 0;
+  efjsonUint32 d;
+  int k, fraction = parser->state == efjsonVal__NUMBER_FRACTION;
+  for(k = 0; k < 8; ++k) {
+    d = src[k] - 0x30 /* '0' */;
+    if(d > 9) return 0;
+    chunk |= efjson_cast(efjsonUint64, d) << (k * 8); /* the first digit is in the lowest byte */
+  }
+    #if EFJSON_CONF_CHECK_POSITION_OVERFLOW
+  if(ul_unlikely(parser->position > efjson_umax(efjsonPosition) - 8)) return 0;
+    #endif
+
+  chunk = chunk * 10 + (chunk >> 8);
+  chunk = ((chunk & mask) * mul1 + ((chunk >> 16) & mask) * mul2) >> 32 & 0xFFFFFFFFu;
+  if(ul_likely(parser->digits <= efjson__MAX_DIGITS - 8)) {
+    if(ul_likely(parser->mantissa != 0)) {
+      parser->mantissa = parser->mantissa * 100000000u + chunk;
+      parser->digits = efjson_cast(efjsonUint8, parser->digits + 8);
+    } else {
+      for(parser->mantissa = chunk; chunk != 0; chunk /= 10) ++parser->digits;
+    }
+    if(fraction && parser->scale > -efjson__MAX_SCALE) parser->scale -= 8;
+  } else {
+    for(k = 0; k < 8; ++k) efjsonStreamParser__numberDigit(parser, src[k] - 0x30 /* '0' */, fraction);
+  }
+
+  memset(dest, 0, sizeof(efjsonToken));
+  if(fraction) {
+    parser->substate = efjsonNumberFraction__Digit;
+    dest[0].type = efjsonType_NUMBER_FRACTION_DIGIT;
+  } else dest[0].type = efjsonType_NUMBER_INTEGER_DIGIT;
+  for(k = 1; k < 8; ++k) dest[k] = dest[0];
+  parser->position += 8; /* digits are never line terminators */
+  parser->column += 8;
+  return 1;
+}
+  #endif /* EFJSON_CONF_NUMBER_VALUE */
+  #if EFJSON_CONF_FIXED_STACK > 0
+    #define efjson__stackCap(parser) efjson_cast(efjsonStackLength, EFJSON_CONF_FIXED_STACK)
+  #else
+    #define efjson__stackCap(parser) ((parser)->cap)
+  #endif
+  #if EFJSON_CONF_COMPRESS_STACK
+    #define efjson__stackEntries(cap) ((cap) << 3)
+  #else
+    #define efjson__stackEntries(cap) (cap)
+  #endif
+/**
+ * Accept a run of the bracket which has just been accepted, spaces and tabs may be between them.
+ * The depth limit is checked once, and the stack is updated a byte at a time.
+ * @return the number of accepted characters, the rest of the run (if any) is left to `efjsonStreamParser__step`
+ */
+EFJSON_PRIVATE size_t efjsonStreamParser__feedBrackets(
+  efjsonStreamParser* parser, efjsonToken* dest, const efjsonUint32* src, size_t len, efjsonUint32 bracket
+) {
+  size_t i, n = 0, count = 0;
+  efjsonUint8 type;
+  for(i = 0; i < len && (src[i] == bracket || src[i] == 0x20 /* ' ' */ || src[i] == 0x09 /* '\t' */); ++i)
+    n += src[i] == bracket;
+  if(n == 0) return 0;
+  #if EFJSON_CONF_CHECK_POSITION_OVERFLOW
+  if(ul_unlikely(parser->position > efjson_umax(efjsonPosition) - i)) return 0;
+  #endif
+
+  if(bracket == 0x5B /* '[' */) {
+    efjsonStackLength k, end;
+    type = efjsonType_ARRAY_START;
+    if(ul_unlikely(n > efjson_umax(efjsonStackLength) - parser->len)) n = efjson_umax(efjsonStackLength) - parser->len;
+  #if !(EFJSON_CONF_FIXED_STACK > 0)
+    while(efjson__stackLen(parser->len + n - 1) >= parser->cap && efjsonStreamParser__enlarge(parser) == 0) { }
+  #endif
+    if(ul_unlikely(efjson__stackLen(parser->len + n - 1) >= efjson__stackCap(parser)))
+      n = efjson__stackEntries(efjson__stackCap(parser)) - parser->len; /* the overflow is reported later */
+    k = parser->len;
+    end = efjson_cast(efjsonStackLength, k + n);
+  #if EFJSON_CONF_COMPRESS_STACK
+    /* each level is an element of an array */
+    for(; k < end && (k & 7) != 0; ++k) parser->stack[k >> 3] |= efjson__bitshl(1, k & 7);
+    memset(parser->stack + (k >> 3), 0xFF, (end - k) >> 3);
+    for(k += (end - k) & ~efjson_cast(efjsonStackLength, 7); k < end; ++k)
+      parser->stack[k >> 3] |= efjson__bitshl(1, k & 7);
+  #else
+    memset(parser->stack + k, efjsonLoc__ELEMENT_FIRST_START, end - k);
+  #endif
+    parser->len = end;
+  } else {
+    efjsonUint8 outer = bracket == 0x5D /* ']' */ ? efjsonLoc__ELEMENT_END : efjsonLoc__VALUE_END;
+    type = bracket == 0x5D /* ']' */ ? efjsonType_ARRAY_END : efjsonType_OBJECT_END;
+    if(parser->location != outer) return 0;
+  #if EFJSON_CONF_COMPRESS_STACK
+    {
+      /* a close is valid if the level below it is of the same kind (but not the root) */
+      efjsonUint8 full = bracket == 0x5D /* ']' */ ? 0xFF : 0x00;
+      efjsonStackLength t = parser->len - 1;
+      count = 1;
+      while(count < n && t >= 1) {
+        if((t & 7) == 7 && t >= 8 && n - count >= 8 && parser->stack[t >> 3] == full) {
+          t -= 8;
+          count += 8;
+        } else if(((parser->stack[t >> 3] >> (t & 7)) & 1) == (full & 1)) {
+          --t;
+          ++count;
+        } else break;
+      }
+      parser->len = efjson_cast(efjsonStackLength, parser->len - count);
+      parser->location = efjson__last(parser);
+    }
+  #else
+    for(; count < n && parser->location == outer; ++count) {
+      --parser->len;
+      parser->location = efjson__last(parser);
+    }
+  #endif
+    n = count;
+  }
+
+  memset(dest, 0, sizeof(efjsonToken) * i);
+  for(i = 0, count = 0; count < n; ++i) {
+    if(src[i] == bracket) {
+      dest[i].type = type;
+      ++count;
+    } else dest[i].type = efjsonType_WHITESPACE;
+  }
+  parser->position += i; /* no line terminator */
+  parser->column += i;
+  return i;
 }
 EFJSON_PUBLIC size_t
 efjsonStreamParser_feed(efjsonStreamParser* parser, efjsonToken* dest, const efjsonUint32* src, size_t len) {
   size_t i;
+  efjsonToken first;
   for(i = 0; i < len; ++i) {
-    efjsonStreamParser__checkPosition(parser, src[i], dest[0], return 0;);
-    dest[i] = efjsonStreamParser__step(parser, src[i]);
+    efjsonStreamParser__checkPosition(parser, src[i], dest[i], break;);
+    dest[i] = efjson__step(parser, src[i]);
     if(ul_likely(dest[i].type != 0)) {
       efjsonStreamParser__movePosition(parser, src[i]);
-    } else {
+      if(ul_unlikely(efjson__isLimited(parser))) continue; /* the limits are checked per character */
+  #if EFJSON_CONF_NUMBER_VALUE
+      /* fast path for long digit runs */
+      if(ul_unlikely(
+           dest[i].type == efjsonType_NUMBER_INTEGER_DIGIT || dest[i].type == efjsonType_NUMBER_FRACTION_DIGIT
+         )
+         && (parser->state == efjsonVal__NUMBER_FRACTION || parser->substate == efjsonNumberState__NON_LEADING_ZERO)) {
+        while(len - i > 8 && efjsonStreamParser__feedEightDigits(parser, dest + i + 1, src + i + 1)) i += 8;
+      }
+  #endif /* EFJSON_CONF_NUMBER_VALUE */
+      /* fast path for long bracket runs, e.g. deeply nested arrays */
+      if(ul_unlikely(dest[i].type == efjsonType_ARRAY_START || dest[i].type == efjsonType_ARRAY_END
+                     || dest[i].type == efjsonType_OBJECT_END)
+         && i + 1 < len && (src[i + 1] == src[i] || src[i + 1] == 0x20 /* ' ' */)) {
+        i += efjsonStreamParser__feedBrackets(parser, dest + i + 1, src + i + 1, len - i - 1, src[i]);
+      }
+    } else break;
+  }
+  if(ul_likely(i == len)) return i;
+  /* swapped, so the tokens before the error are kept */
+  first = dest[0];
+  dest[0] = dest[i];
+  dest[i] = first;
+  return 0;
+}
+EFJSON_PUBLIC size_t efjsonStreamParser_feedUntil(
+  efjsonStreamParser* parser, efjsonToken* dest, const efjsonUint32* src, size_t len, int (*expired)(void* opaque),
+  void* opaque
+) {
+  size_t i = 0, n;
+  while(i < len) {
+    n = len - i < EFJSON_FEED_SLICE ? len - i : EFJSON_FEED_SLICE;
+    if(ul_unlikely(efjsonStreamParser_feed(parser, dest + i, src + i, n) == 0)) {
       dest[0] = dest[i];
       return 0;
     }
+    i += n;
+    if(i < len && expired(opaque)) break;
   }
   return i;
 }
+  #if EFJSON_CONF_UTF_ENCODER
+EFJSON_PUBLIC size_t efjsonStreamParser_feedv(
+  efjsonStreamParser* parser, efjsonUtf8Decoder* decoder, efjsonToken* dest, efjsonUint32* chars,
+  const efjsonIovec* iov, size_t n
+) {
+  size_t count = 0, begin, consumed, k;
+  for(k = 0; k < n; ++k) {
+    /* decode the whole fragment, then feed it in bulk */
+    begin = count;
+    count += efjsonUtf8Decoder_decode(
+      decoder, chars + count, efjson_reptr(const efjsonUint8*, iov[k].base), iov[k].len, &consumed
+    );
+    if(count != begin
+       && ul_unlikely(efjsonStreamParser_feed(parser, dest + begin, chars + begin, count - begin) == 0)) {
+      dest[0] = dest[begin];
+      return 0;
+    }
+    if(ul_unlikely(consumed != iov[k].len)) { /* after the characters before it, so the first error is reported */
+      memset(dest, 0, sizeof(efjsonToken));
+      dest[0].type = efjsonType_ERROR;
+      dest[0].extra = efjsonError_INVALID_INPUT_UTF;
+      return 0;
+    }
+  }
+  return count;
+}
+  #endif /* EFJSON_CONF_UTF_ENCODER */
+  #if EFJSON_CONF_SIMD
+/** count the bits of a mask with at most 16 bits */
+EFJSON_PRIVATE unsigned efjson__popcount16(unsigned m) {
+  m = m - ((m >> 1) & 0x5555u);
+  m = (m & 0x3333u) + ((m >> 2) & 0x3333u);
+  m = (m + (m >> 4)) & 0x0F0Fu;
+  return (m + (m >> 8)) & 0x1Fu;
+}
+  #endif /* EFJSON_CONF_SIMD */
+  #if EFJSON_INT64
+typedef efjsonUint64 efjson__Word;
+  #else
+typedef efjsonUint32 efjson__Word;
+  #endif
+/** count the bytes whose highest bit is set, the other bits must be clear */
+EFJSON_PRIVATE unsigned efjson__countHigh(efjson__Word m) {
+  const efjson__Word ones = efjson_umax(efjson__Word) / 0xFF;
+  return efjson_cast(unsigned, ((m >> 7) * ones) >> ((sizeof(efjson__Word) - 1) * 8));
+}
+/**
+ * Count the leading bytes of `src` that `efjsonStreamParser_skipUtf8` doesn't need to inspect one by one.
+ * Inside strings they are bytes other than quotes, '\\', line terminators and 0xE2 (the lead of U+2028/U+2029),
+ * outside strings brackets and '/' are inspected as well.
+ * @param chars increased by the number of characters in them (continuation bytes are not counted)
+ */
+EFJSON_PRIVATE size_t efjson__scanSkippable(const efjsonUint8* src, size_t len, int inString, efjsonPosition* chars) {
+  const efjson__Word ones = efjson_umax(efjson__Word) / 0xFF, high = ones * 0x80;
+  efjson__Word w, lower, hit, cont;
+  size_t i = 0, k;
+  #if EFJSON_CONF_SIMD
+  const __m128i mask = _mm_set1_epi8(efjson_cast(char, 0xC0)), lead = _mm_set1_epi8(efjson_cast(char, 0x80));
+  __m128i v, h;
+  unsigned stop, tail;
+  for(; len - i >= 16; i += 16) {
+    v = _mm_loadu_si128(efjson_cast(const __m128i*, efjson_cast(const void*, src + i)));
+    #define efjson__eq(v, c) _mm_cmpeq_epi8((v), _mm_set1_epi8(efjson_cast(char, c)))
+    h = _mm_or_si128(
+      _mm_or_si128(efjson__eq(v, 0x22 /* '"' */), efjson__eq(v, 0x27 /* '\'' */)),
+      _mm_or_si128(efjson__eq(v, 0x5C /* '\\' */), efjson__eq(v, 0x0A /* '\n' */))
+    );
+    h = _mm_or_si128(h, _mm_or_si128(efjson__eq(v, 0x0D /* '\r' */), efjson__eq(v, 0xE2)));
+    if(!inString) {
+      __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20)); /* '[' -> '{', ']' -> '}' */
+      h = _mm_or_si128(h, _mm_or_si128(efjson__eq(folded, 0x7B /* '{' */), efjson__eq(folded, 0x7D /* '}' */)));
+      h = _mm_or_si128(h, efjson__eq(v, 0x2F /* '/' */));
+    }
+    #undef efjson__eq
+    stop = efjson_cast(unsigned, _mm_movemask_epi8(h));
+    tail = efjson_cast(unsigned, _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, mask), lead)));
+    if(stop != 0) {
+      stop = (stop & (0u - stop)) - 1; /* the bytes before the first stop */
+      *chars += efjson__popcount16(stop) - efjson__popcount16(tail & stop);
+      return i + efjson__popcount16(stop);
+    }
+    *chars += 16 - efjson__popcount16(tail);
+  }
+  #endif /* EFJSON_CONF_SIMD */
+  for(; len - i >= sizeof(efjson__Word); i += sizeof(efjson__Word)) {
+    for(w = 0, k = sizeof(efjson__Word); k-- > 0;) w = w << 8 | src[i + k]; /* the first byte is the lowest */
+  #define efjson__hasByte(w, c) ((((w) ^ (ones * (c))) - ones) & ~((w) ^ (ones * (c))))
+    hit = efjson__hasByte(w, 0x22 /* '"' */) | efjson__hasByte(w, 0x27 /* '\'' */)
+          | efjson__hasByte(w, 0x5C /* '\\' */) | efjson__hasByte(w, 0x0A /* '\n' */)
+          | efjson__hasByte(w, 0x0D /* '\r' */) | efjson__hasByte(w, 0xE2);
+    if(!inString) {
+      lower = w | (ones * 0x20); /* '[' -> '{', ']' -> '}' */
+      hit |= efjson__hasByte(lower, 0x7B /* '{' */) | efjson__hasByte(lower, 0x7D /* '}' */)
+             | efjson__hasByte(w, 0x2F /* '/' */);
+    }
+  #undef efjson__hasByte
+    /* a false positive only follows a real match, so the lowest one is exact */
+    hit &= high;
+    cont = w & ~(w << 1) & high;
+    if(hit != 0) {
+      hit = (hit & (0u - hit)) - 1;
+      *chars += efjson__countHigh(hit & high) - efjson__countHigh(cont & hit);
+      return i + efjson__countHigh(hit & high);
+    }
+    *chars += sizeof(efjson__Word) - efjson__countHigh(cont);
+  }
+  return i;
+}
+EFJSON_PUBLIC size_t efjsonStreamParser_skipUtf8(
+  efjsonStreamParser* parser, efjsonToken* token, efjsonStackLength depth, const efjsonUint8* src, size_t len
+) {
+  size_t i;
+  efjsonUint32 u;
+  memset(token, 0, sizeof(efjsonToken));
+  token->type = efjsonType_WHITESPACE;
+  for(i = 0; i < len; ++i) {
+    if(parser->len == depth && parser->state == efjsonVal__EMPTY) break;
+    u = src[i];
+    if(ul_likely(!(parser->flag & efjsonFlag__MeetCr)) && !efjson__isLimited(parser)
+       && (parser->state == efjsonVal__STRING || parser->state == efjsonVal__EMPTY)) {
+      efjsonPosition chars = 0;
+      size_t n = efjson__scanSkippable(src + i, len - i, parser->state == efjsonVal__STRING, &chars);
+  #if EFJSON_CONF_CHECK_POSITION_OVERFLOW
+      if(ul_unlikely(parser->position > efjson_umax(efjsonPosition) - chars)) n = 0; /* reported one by one */
+  #endif
+      if(n != 0) {
+        parser->position += chars;
+        parser->column += chars;
+        if((i += n) == len) break;
+      }
+    }
+    u = src[i];
+    if(ul_unlikely(u >= 0x80)) {
+      if((u & 0xC0) == 0x80) continue; /* continuation byte has been counted */
+      /* U+2028 and U+2029 are line terminators */
+      u = (u == 0xE2 && i + 2 < len && src[i + 1] == 0x80 && (src[i + 2] | 1) == 0xA9) ? 0x2028 : 0x80;
+    }
+    efjsonStreamParser__checkPosition(parser, u, *token, return i;);
+  #if EFJSON_CONF_LIMITS
+    if(ul_unlikely(efjson__isLimited(parser)) && parser->limits.maxInput != 0
+       && parser->position >= parser->limits.maxInput) {
+      token->type = efjsonType_ERROR;
+      token->extra = efjsonError_INPUT_TOO_LONG;
+      return i;
+    }
+  #endif
+
+    switch(parser->state) {
+    case efjsonVal__EMPTY:
+      switch(u) {
+      case 0x22 /* '"' */:
+        parser->state = efjsonVal__STRING;
+        parser->flag &= ~efjsonFlag__SingleQuote;
+        break;
+  #if EFJSON_CONF_EXTENDED_JSON
+      case 0x27 /* '\'' */:
+        if(parser->option & efjsonOption_SINGLE_QUOTE) {
+          parser->state = efjsonVal__STRING;
+          parser->flag |= efjsonFlag__SingleQuote;
+        }
+        break;
+      case 0x2F /* '/' */:
+        if(parser->option & (efjsonOption_SINGLE_LINE_COMMENT | efjsonOption_MULTI_LINE_COMMENT))
+          parser->state = efjsonVal__COMMENT_MAY_START;
+        break;
+  #endif /* EFJSON_CONF_EXTENDED_JSON */
+      case 0x5B /* '[' */:
+      case 0x7B /* '{' */:
+  #if EFJSON_CONF_LIMITS
+        if(ul_unlikely(efjson__isLimited(parser)) && parser->limits.maxDepth != 0
+           && parser->len >= parser->limits.maxDepth) {
+          token->type = efjsonType_ERROR;
+          token->extra = efjsonError_TOO_DEEP;
+          return i;
+        }
+  #endif
+  #if EFJSON_CONF_FIXED_STACK > 0
+        if(ul_unlikely(efjson__stackLen(parser->len) == EFJSON_CONF_FIXED_STACK)) {
+          token->type = efjsonType_ERROR;
+          token->extra = efjsonError_TOO_MANY_RECURSIONS;
+          return i;
+        }
+  #else
+        if(ul_unlikely(efjson__stackLen(parser->len) == parser->cap)) {
+          token->extra = efjsonStreamParser__enlarge(parser);
+          if(ul_unlikely(token->extra != 0)) {
+            token->type = efjsonType_ERROR;
+            return i;
+          }
+        }
+  #endif
+        /* only the kind of the container matters inside the skipped value */
+        efjson__push(
+          parser, efjson__transformLocation(parser->location) == efjsonLocation_ELEMENT ? efjsonLoc__ELEMENT_START
+                                                                                        : efjsonLoc__VALUE_START
+        );
+        parser->location = u == 0x5B ? efjsonLoc__ELEMENT_FIRST_START : efjsonLoc__KEY_FIRST_START;
+        break;
+      case 0x5D /* ']' */:
+      case 0x7D /* '}' */:
+        if(ul_unlikely(
+             parser->len == 0
+             || (efjson__transformLocation(parser->location) == efjsonLocation_ELEMENT) != (u == 0x5D)
+           )) {
+          token->type = efjsonType_ERROR;
+          token->extra = efjsonError_WRONG_BRACKET;
+          return i;
+        }
+        --parser->len;
+        parser->location = efjson__last(parser);
+        break;
+      default:
+        break;
+      }
+      break;
+
+  #if EFJSON_CONF_EXTENDED_JSON
+    case efjsonVal__STRING_MULTILINE_CR:
+  #endif /* EFJSON_CONF_EXTENDED_JSON */
+    case efjsonVal__STRING:
+      if(u == (ul_unlikely(parser->flag & efjsonFlag__SingleQuote) ? 0x27u /* '\'' */ : 0x22u /* '"' */)) {
+        parser->state = efjsonVal__EMPTY;
+        if(parser->len == depth) parser->location = efjson__nextLocation(parser->location);
+      } else if(u == 0x5C /* '\\' */) {
+        parser->state = efjsonVal__STRING_ESCAPE;
+      } else {
+        parser->state = efjsonVal__STRING;
+      }
+      break;
+    case efjsonVal__STRING_ESCAPE:
+      parser->state = efjsonVal__STRING; /* the escaped sequence contains no quote */
+      break;
+
+  #if EFJSON_CONF_EXTENDED_JSON
+    case efjsonVal__COMMENT_MAY_START:
+      if((parser->option & efjsonOption_SINGLE_LINE_COMMENT) && u == 0x2F /* '/' */) {
+        parser->state = efjsonVal__SINGLE_LINE_COMMENT;
+      } else if(ul_likely((parser->option & efjsonOption_MULTI_LINE_COMMENT) && u == 0x2A /* '*' */)) {
+        parser->state = efjsonVal__MULTI_LINE_COMMENT;
+      } else {
+        token->type = efjsonType_ERROR;
+        token->extra = efjsonError_COMMENT_FORBIDDEN;
+        return i;
+      }
+      break;
+    case efjsonVal__SINGLE_LINE_COMMENT:
+      if(efjson__isNextLine(u)) parser->state = efjsonVal__EMPTY;
+      break;
+    case efjsonVal__MULTI_LINE_COMMENT:
+      if(u == 0x2A /* '*' */) parser->state = efjsonVal__MULTI_LINE_COMMENT_MAY_END;
+      break;
+    case efjsonVal__MULTI_LINE_COMMENT_MAY_END:
+      if(u == 0x2F /* '/' */) parser->state = efjsonVal__EMPTY;
+      else if(u != 0x2A /* '*' */) parser->state = efjsonVal__MULTI_LINE_COMMENT;
+      break;
+  #endif /* EFJSON_CONF_EXTENDED_JSON */
+
+    default:
+      /* the parser is inside a literal, a number or an escape sequence */
+      token->type = efjsonType_ERROR;
+      token->extra = efjsonError_UNEXPECTED;
+      return i;
+    }
+    efjsonStreamParser__movePosition(parser, u);
+  }
+  token->done = parser->len == depth && parser->state == efjsonVal__EMPTY;
+  return i;
+}
+  #if EFJSON_CONF_UTF_ENCODER
+EFJSON_PUBLIC size_t efjsonStreamParser_skipValidUtf8(
+  efjsonStreamParser* parser, efjsonToken* token, efjsonStackLength depth, const efjsonUint8* src, size_t len
+) {
+  size_t i, begin = 0;
+  efjsonUint32 u;
+  efjsonUtf8Decoder decoder;
+  efjsonUtf8Decoder_init(&decoder);
+  memset(token, 0, sizeof(efjsonToken));
+  token->type = efjsonType_WHITESPACE;
+  for(i = 0; i < len; ++i) {
+    if(parser->len == depth && parser->state == efjsonVal__EMPTY) break;
+    switch(efjsonUtf8Decoder_feed(&decoder, &u, src[i])) {
+    case 0:
+      continue;
+    case -1:
+      token->type = efjsonType_ERROR;
+      token->extra = efjsonError_INVALID_INPUT_UTF;
+      return begin;
+    }
+    efjsonStreamParser__checkPosition(parser, u, *token, return begin;);
+    *token = efjson__step(parser, u);
+    if(ul_unlikely(token->type == efjsonType_ERROR)) return begin;
+    efjsonStreamParser__movePosition(parser, u);
+    begin = i + 1;
+  }
+  memset(token, 0, sizeof(efjsonToken));
+  token->type = efjsonType_WHITESPACE;
+  token->done = parser->len == depth && parser->state == efjsonVal__EMPTY;
+  return begin; /* a character broken at the end is left to the next call */
+}
+/** load 4 bytes, the first one is in the lowest byte */
+EFJSON_PRIVATE efjsonUint32 efjson__load4(const efjsonUint8* p) {
+  return efjson_cast(efjsonUint32, p[0]) | efjson_cast(efjsonUint32, p[1]) << 8
+         | efjson_cast(efjsonUint32, p[2]) << 16 | efjson_cast(efjsonUint32, p[3]) << 24;
+}
+/**
+ * Validate and convert 4 hex digits at once by SWAR.
+ * @return -1 if any of them is not a hex digit.
+ */
+EFJSON_PRIVATE long efjson__hexQuad(efjsonUint32 w) {
+  const efjsonUint32 ones = 0x01010101u, high = 0x80808080u;
+  efjsonUint32 lower = w | 0x20202020u, digit, letter;
+  if(w & high) return -1;
+  /* the highest bit of each byte is set if it's in the range (no carry as the bytes are ASCII) */
+  digit = (w + ones * (0x80 - 0x30 /* '0' */)) & ~(w + ones * (0x7F - 0x39 /* '9' */)) & high;
+  letter = (lower + ones * (0x80 - 0x61 /* 'a' */)) & ~(lower + ones * (0x7F - 0x66 /* 'f' */)) & high;
+  if((digit | letter) != high) return -1;
+  w = (w & 0x0F0F0F0Fu) + (letter >> 7) * 9;
+  w = (w << 4 | w >> 8) & 0x00FF00FFu;
+  return efjson_cast(long, (w & 0xFFu) << 8 | w >> 16);
+}
+EFJSON_PUBLIC size_t efjsonStreamParser_unescapeUtf8(
+  efjsonStreamParser* parser, efjsonUint8* dest, size_t* written, const efjsonUint8* src, size_t len
+) {
+  size_t i = 0, w = 0, n;
+  long high;
+    #if EFJSON_CONF_COMBINE_ESCAPED_SURROGATE
+  long low;
+    #endif
+  efjsonUint32 u;
+  efjsonUint8 buf[4];
+  *written = 0;
+  if(parser->state != efjsonVal__STRING || efjson__isLimited(parser)) return 0;
+  while(len - i >= 6 && src[i] == 0x5C /* '\\' */ && src[i + 1] == 0x75 /* 'u' */) {
+    if((high = efjson__hexQuad(efjson__load4(src + i + 2))) < 0) break;
+    u = efjson_cast(efjsonUint32, high);
+    n = 6;
+    if(ul_unlikely(efjson__isUtf16Surrogate(u))) {
+    #if EFJSON_CONF_COMBINE_ESCAPED_SURROGATE
+      if(u > 0xDBFFu || len - i < 12 || src[i + 6] != 0x5C /* '\\' */ || src[i + 7] != 0x75 /* 'u' */) break;
+      low = efjson__hexQuad(efjson__load4(src + i + 8));
+      if(low < 0xDC00L || low > 0xDFFFL) break;
+      u = (efjson_cast(efjsonUint32, u & 0x3FFu) << 10 | efjson_cast(efjsonUint32, low & 0x3FF)) + 0x10000u;
+      n = 12;
+    #else
+      break; /* left to the normal path */
+    #endif
+    }
+    #if EFJSON_CONF_CHECK_POSITION_OVERFLOW
+    if(ul_unlikely(parser->position > efjson_umax(efjsonPosition) - n)) break;
+    #endif
+    if(dest != NULL) {
+      /* encode before writing, as `dest` may alias the input */
+      int k, m = efjson_EncodeUtf8(buf, u);
+      for(k = 0; k < m; ++k) dest[w++] = buf[k];
+    }
+    parser->position += n; /* escapes are never line terminators */
+    parser->column += n;
+    i += n;
+  }
+  *written = w;
+  return i;
+}
+  #endif /* EFJSON_CONF_UTF_ENCODER */
   #undef efjsonStreamParser__checkPosition
   #undef efjsonStreamParser__movePosition
+  #if EFJSON_CONF_COMPRESS_STACK
+    #undef efjson__bitshl
+    #undef efjson___pushArray
+    #undef efjson___pushObject
+  #endif
+  #undef efjson__stackLen
+  #undef efjson__push
+  #undef efjson__last
+  #undef efjson__nextLocation
+  #undef efjson__isUtf16Surrogate
 
 
 EFJSON_PUBLIC efjsonPosition efjsonStreamParser_getLine(const efjsonStreamParser* parser) {
@@ -2882,6 +4478,92 @@ EFJSON_PUBLIC efjsonPosition efjsonStreamParser_getPosition(const efjsonStreamPa
 EFJSON_PUBLIC efjsonUint8 efjsonStreamParser_getLocation(const efjsonStreamParser* parser) {
   return efjson__transformLocation(parser->location);
 }
+EFJSON_PUBLIC efjsonStackLength efjsonStreamParser_getDepth(const efjsonStreamParser* parser) {
+  return parser->len;
+}
+  #if EFJSON_CONF_NUMBER_VALUE
+EFJSON_PUBLIC int efjsonStreamParser_getInt64(const efjsonStreamParser* parser, efjsonInt64* value) {
+  efjsonUint64 magnitude = parser->mantissa;
+  long scale;
+  if(parser->numberFlag
+     & (efjsonNumberFlag__Truncated | efjsonNumberFlag__Infinity | efjsonNumberFlag__NaN | efjsonNumberFlag__Float))
+    return 0;
+  if(parser->numberFlag & efjsonNumberFlag__Binary) {
+    if(parser->scale != 0) return 0;
+  } else {
+    /* dropped trailing zeros */
+    for(scale = parser->scale; scale > 0; --scale) {
+      if(magnitude > efjson_umax(efjsonUint64) / 10) return 0;
+      magnitude *= 10;
+    }
+  }
+  if(parser->numberFlag & efjsonNumberFlag__Negative) {
+    if(magnitude > (efjson_cast(efjsonUint64, 1) << 63)) return 0;
+    *value = magnitude == 0 ? 0 : -efjson_cast(efjsonInt64, magnitude - 1) - 1;
+  } else {
+    if(magnitude >= (efjson_cast(efjsonUint64, 1) << 63)) return 0;
+    *value = efjson_cast(efjsonInt64, magnitude);
+  }
+  return 1;
+}
+EFJSON_PUBLIC int efjsonStreamParser_getDouble(const efjsonStreamParser* parser, double* value) {
+  int ret = 1;
+  if(ul_unlikely(parser->numberFlag & efjsonNumberFlag__NaN)) {
+    *value = efjson__bitsToDouble(efjson__DOUBLE_NAN);
+  } else if(ul_unlikely(parser->numberFlag & efjsonNumberFlag__Infinity)) {
+    *value = efjson__bitsToDouble(efjson__DOUBLE_INFINITY);
+  } else if(ul_unlikely(parser->numberFlag & efjsonNumberFlag__Binary)) {
+    /* the conversion rounds once, unless dropped digits break a tie */
+    *value = efjson_cast(double, parser->mantissa);
+    if(parser->scale != 0)
+      *value *= efjson__bitsToDouble(
+        parser->scale < 0x3FF ? efjson_cast(efjsonUint64, 0x3FF + parser->scale) << 52 : efjson__DOUBLE_INFINITY
+      );
+    ret = !(parser->numberFlag & efjsonNumberFlag__Truncated);
+  } else {
+    ret = efjson__decimalToDouble(
+      parser->mantissa, efjson__numberPower(parser),
+      parser->numberFlag & efjsonNumberFlag__Truncated, value
+    );
+  }
+  if(parser->numberFlag & efjsonNumberFlag__Negative) *value = -*value;
+  return ret;
+}
+  #endif /* EFJSON_CONF_NUMBER_VALUE */
+  #if EFJSON_CONF_NUMBER_SPAN
+EFJSON_PUBLIC void efjsonStreamParser_getNumberSpan(const efjsonStreamParser* parser, efjsonNumberSpan* span) {
+  efjsonUint16 flag = parser->spanFlag;
+  efjsonPosition end = parser->numberEnd;
+  span->begin = parser->numberBegin;
+  span->flag = efjson_cast(efjsonUint8, flag);
+  span->integer = (flag & efjsonSpanFlag__Sign) ? 1 : 0;
+  if(flag & (efjsonNumberFlag_INFINITY | efjsonNumberFlag_NAN)) {
+    /* ended by its last character rather than a separator */
+    end = span->begin + span->integer + ((flag & efjsonNumberFlag_NAN) ? 3 : 8);
+    span->integerDigits = 0;
+  } else {
+    if(flag & (efjsonNumberFlag_HEXADECIMAL | efjsonNumberFlag_OCTAL | efjsonNumberFlag_BINARY)) span->integer += 2;
+    span->integerDigits = ((flag & efjsonSpanFlag__Point)      ? parser->numberPoint
+                           : (flag & efjsonSpanFlag__Exponent) ? parser->numberExponent
+                                                               : end)
+                          - span->begin - span->integer;
+  }
+  span->length = end - span->begin;
+  span->fraction = span->integer + span->integerDigits;
+  span->fractionDigits = 0;
+  if(flag & efjsonSpanFlag__Point) {
+    span->fraction = parser->numberPoint - span->begin + 1;
+    span->fractionDigits = ((flag & efjsonSpanFlag__Exponent) ? parser->numberExponent : end) - span->begin
+                           - span->fraction;
+  }
+  span->exponent = span->length;
+  span->exponentDigits = 0;
+  if(flag & efjsonSpanFlag__Exponent) {
+    span->exponent = parser->numberExponent - span->begin + ((flag & efjsonSpanFlag__ExponentSign) ? 2 : 1);
+    span->exponentDigits = span->length - span->exponent;
+  }
+}
+  #endif /* EFJSON_CONF_NUMBER_SPAN */
 EFJSON_PUBLIC enum efjsonStage efjsonStreamParser_getStage(const efjsonStreamParser* parser) {
   if(parser->state == efjsonVal__EMPTY) return efjsonStage_PARSING;
   else if(parser->location == efjsonLoc__ROOT_START) return efjsonStage_NOT_STARTED;
@@ -11,6 +11,7 @@
 #include <format>
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 std::mt19937 rng(std::random_device{}());
 std::string genArray() {
@@ -105,6 +106,27 @@ void measureStep(const std::u32string& str) {
   efjsonStreamParser_feedOne(parser, 0);
   efjsonStreamParser_destroy(parser);
 }
+std::u32string toUtf32(const std::string& ascii) {
+  return std::u32string(ascii.begin(), ascii.end());
+}
+/** feed the whole input at once, so that the bulk paths of `efjsonStreamParser_feed` apply */
+void measureFeed(const std::u32string& str) {
+  auto parser = efjsonStreamParser_new(0);
+  std::vector<efjsonToken> tokens(str.size());
+  efjsonStreamParser_feed(parser, tokens.data(), reinterpret_cast<const efjsonUint32*>(str.data()), str.size());
+  efjsonStreamParser_feedOne(parser, 0);
+  efjsonStreamParser_destroy(parser);
+}
+/** decode UTF-8 in bulk, which widens ASCII blocks without the state machine */
+void measureDecode(const std::string& str) {
+  efjsonUtf8Decoder decoder;
+  std::vector<efjsonUint32> chars(str.size());
+  size_t consumed;
+  efjsonUtf8Decoder_init(&decoder);
+  ankerl::nanobench::doNotOptimizeAway(efjsonUtf8Decoder_decode(
+    &decoder, chars.data(), reinterpret_cast<const efjsonUint8*>(str.data()), str.size(), &consumed
+  ));
+}
 
 auto readFileIntoUtf32(const std::string& filename) {
   std::ifstream file(filename, std::ios::binary);
@@ -135,6 +157,8 @@ int main() {
   bencher.run("number", ([str = genNumber()] { measureStep(str); }));
   bencher.run("string", ([str = genString()] { measureStep(str); }));
   bencher.run("recursive_array", ([str = genRecursiveArray()] { measureStep(str); }));
+  bencher.run("recursive_array (feed)", ([str = toUtf32(genRecursiveArray())] { measureFeed(str); }));
+  bencher.run("string (decode)", ([str = genString()] { measureDecode(str); }));
 
   bencher.run("*canada", ([str = readFileIntoUtf32("./data/canada.json")] { measureStep(str); }));
   bencher.run("*citm", ([str = readFileIntoUtf32("./data/citm_catalog.json")] { measureStep(str); }));
@@ -6,19 +6,21 @@
 #include <random>
 #include <format>
 #include <iostream>
-#include <fstream>
+#include <sstream>
 #include <memory>
 #include <filesystem>
+#include <array>
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
 
 auto readFileIntoUtf32(const std::string& filename) {
-  std::ifstream file(filename, std::ios::binary);
-  if(!file) throw std::runtime_error("file not found or could not be opened");
+  efjson::MappedFile file(filename);
   std::u32string content;
   efjsonUtf8Decoder decoder;
   efjsonUtf8Decoder_init(&decoder);
-  int c;
   efjsonUint32 u;
-  while((c = file.get()) != EOF) {
+  for(char8_t c: file.view()) {
     switch(efjsonUtf8Decoder_feed(&decoder, &u, static_cast<efjsonUint8>(c))) {
     case 1:
       content.push_back(static_cast<char32_t>(u));
@@ -100,8 +102,1132 @@ void testJson5() {
   }
 }
 
+void expect(bool cond, const char* what) {
+  if(!cond) {
+    std::cout << "failed: " << what << '\n';
+    abort();
+  }
+}
+
+void testLazyDocument() {
+  std::cout << "===lazy document\n";
+  static const char8_t src[] = u8R"({
+    "id": 1234567890123, "name": "efjson \"lazy\" \uD83D\uDE00", "ratio": -1.25e2,
+    "flags": [true, false, null], "nested": {"empty": {}, "list": [[], [1, [2]], 3]}
+  })";
+  efjson::LazyDocument doc(src);
+  auto root = doc.root();
+  expect(root.category() == efjson::Category::Object && root.size() == 5, "root");
+  expect(root["id"].get<int64_t>() == 1234567890123, "integer");
+  expect(root["name"].get<std::u8string_view>() == u8"efjson \"lazy\" \U0001F600", "escaped string");
+  expect(root["ratio"].get<double>() == -125.0, "double");
+  expect(root["flags"][0].get<bool>() && !root["flags"][1].get<bool>() && root["flags"][2].isNull(), "literals");
+  expect(root["nested"]["list"][1][1][0].get<int>() == 2, "nesting");
+  expect(root["nested"]["list"][2].get<unsigned>() == 3, "sibling after nesting");
+  expect(!root.find("missing") && root["nested"]["empty"].size() == 0, "missing key");
+
+  size_t count = 0;
+  for(auto value: root) {
+    expect(value.key() == std::array{ u8"id", u8"name", u8"ratio", u8"flags", u8"nested" }[count], "member key");
+    ++count;
+  }
+  expect(count == 5, "member count");
+
+  try {
+    (void)root["name"].get<int>();
+    expect(false, "type mismatch should throw");
+  } catch(const efjson::JsonValueException&) { }
+
+  efjson::LazyDocument json5(u8"{a:0x1F, 'b\\u0041':[+1,.5,],c\\u0041:Infinity}", EFJSON_JSON5_OPTION);
+  expect(json5.root()["a"].get<int>() == 31, "hexadecimal");
+  expect(json5.root()["bA"][0].get<int>() == 1 && json5.root()["bA"][1].get<double>() == 0.5, "JSON5 numbers");
+  expect(json5.root()["cA"].get<double>() == std::numeric_limits<double>::infinity(), "escaped identifier");
+  std::cout << "passed\n";
+}
+
+void testCursor() {
+  std::cout << "===cursor\n";
+  static const char8_t src[] = u8R"({
+    "skipped": {"a": ["]", "\"}", {"b": [1, 2]}], "c": "x\\"}, "id": -42,
+    "name": "tab\there", "ratio": 2.5, "tags": ["x", "y"], "ok": true, "none": null
+  })";
+  efjson::Cursor cursor(src);
+  int64_t id = 0;
+  double ratio = 0;
+  bool ok = false;
+  std::u8string name;
+  std::vector<std::u8string> tags;
+  cursor.enterObject();
+  while(auto key = cursor.nextKey()) {
+    if(*key == u8"id") id = cursor.getInt64();
+    else if(*key == u8"name") name = cursor.getString();
+    else if(*key == u8"ratio") ratio = cursor.getDouble();
+    else if(*key == u8"ok") ok = cursor.getBool();
+    else if(*key == u8"tags") {
+      cursor.enterArray();
+      while(cursor.nextElement()) tags.emplace_back(cursor.getString());
+    } else if(*key == u8"none") {
+      expect(cursor.peek() == efjson::Category::Null, "peek");
+      cursor.getNull();
+    } else cursor.skipValue();
+  }
+  expect(id == -42 && ratio == 2.5 && ok, "scalars");
+  expect(name == u8"tab\there" && tags.size() == 2 && tags[1] == u8"y", "strings");
+  cursor.end();
+  expect(cursor.offset() == std::size(src) - 1, "ended");
+
+  {
+    efjson::Cursor numbers(u8"[1,[2,\"3\"],4]");
+    int64_t sum = 0;
+    numbers.enterArray();
+    while(numbers.nextElement()) {
+      if(numbers.peek() == efjson::Category::Number) sum += numbers.getInt64();
+      else numbers.skipValue();
+    }
+    expect(sum == 5, "skip nested array");
+  }
+
+  try {
+    efjson::Cursor broken(u8"[{\"a\": [1}]");
+    broken.enterArray();
+    broken.nextElement();
+    broken.skipValue();
+    expect(false, "wrong bracket should throw");
+  } catch(const efjson::JsonStreamParserException&) { }
+
+  {
+    efjson::Cursor json5(u8"{a:/* } */'b\\u0041', \\u0063d: [0x10,],}", EFJSON_JSON5_OPTION);
+    json5.enterObject();
+    expect(*json5.nextKey() == u8"a" && json5.getString() == u8"bA", "JSON5 string");
+    expect(*json5.nextKey() == u8"cd", "escaped identifier");
+    json5.skipValue();
+    expect(!json5.nextKey(), "trailing comma");
+  }
+  std::cout << "passed\n";
+}
+
+void testSkip() {
+  std::cout << "===skip\n";
+  std::u8string src = u8"[{\"text\": \"long text with \u65e5\u672c\u8a9e, \\\" and \\u0041 \u2028 inside\",\n"
+                      u8"  \"nested\": [[1, 2, 3], {\"k\": \"]}\"}],\r\n  \"flag\": tru}, \"after\"]";
+  efjson::StreamParser reference;
+  reference.feed(std::u8string_view(src).substr(0, src.find(u8"tru}")));
+  {
+    efjson::Cursor cursor(src);
+    cursor.enterArray();
+    cursor.nextElement();
+    cursor.skipValue();
+    size_t chars = static_cast<size_t>(std::ranges::count_if(
+      std::u8string_view(src).substr(0, cursor.offset()), [](char8_t c) { return (c & 0xC0) != 0x80; }
+    ));
+    expect(cursor.getPosition() == chars && cursor.getLine() == 3, "position after the skipped value");
+    expect(cursor.nextElement() && cursor.getString() == u8"after", "value after the skipped one");
+  }
+  {
+    /* the line and column are the same as parsing the bytes one by one */
+    efjson::Cursor cursor(src);
+    cursor.validateSkipped(true);
+    cursor.enterArray();
+    cursor.nextElement();
+    bool thrown = false;
+    try {
+      cursor.skipValue();
+    } catch(const efjson::JsonStreamParserException&) {
+      thrown = true;
+    }
+    expect(thrown, "validated skip");
+    expect(cursor.getLine() == reference.getLine() && cursor.getColumn() == reference.getColumn() + 3, "location");
+  }
+  std::cout << "passed\n";
+}
+
+void testBracketRuns() {
+  std::cout << "===bracket runs\n";
+  std::u32string src = U"{\"a\": ";
+  for(int i = 0; i < 100000; ++i) src += i % 3 == 0 ? U"[ " : U"[";
+  src += U"{\"b\": {\"c\": 1}}";
+  for(int i = 0; i < 100000; ++i) src += i % 5 == 0 ? U"\t]" : U"]";
+  src += U"}";
+  std::vector<efjsonToken> tokens(src.size());
+  auto parser = efjsonStreamParser_new(0);
+  auto feed = [&] {
+    auto input = reinterpret_cast<const efjsonUint32*>(src.data());
+    return efjsonStreamParser_feed(parser, tokens.data(), input, src.size());
+  };
+  size_t n = feed();
+  expect(n == src.size() && efjsonStreamParser_getDepth(parser) == 0, "nested arrays");
+  for(size_t i = 0; i < src.size(); ++i) {
+    efjsonUint8 type = src[i] == U'['   ? static_cast<efjsonUint8>(efjsonType_ARRAY_START)
+                       : src[i] == U']' ? static_cast<efjsonUint8>(efjsonType_ARRAY_END)
+                                        : tokens[i].type;
+    expect(tokens[i].type == type && (src[i] != U' ' || type == efjsonType_WHITESPACE), "tokens of the runs");
+  }
+  expect(efjsonStreamParser_getColumn(parser) == src.size(), "position");
+  efjsonStreamParser_destroy(parser);
+
+  /* the run stops at the first wrong bracket */
+  src = U"[[[[[[[[[[[[[[[[[[[[{\"a\":[[[]]]]]]}";
+  parser = efjsonStreamParser_new(0);
+  n = feed();
+  expect(n == 0 && tokens[0].extra == efjsonError_WRONG_BRACKET, "wrong bracket");
+  expect(efjsonStreamParser_getPosition(parser) == src.find(U"]") + 3, "wrong bracket position");
+  efjsonStreamParser_destroy(parser);
+  std::cout << "passed\n";
+}
+
+void testLimits() {
+  std::cout << "===limits\n";
+  auto parser = efjsonStreamParser_new(0);
+  efjsonToken tokens[64];
+  /* the index of the failed character, or -1 if the whole input (and EOF) is accepted */
+  auto check = [&](const efjsonLimits& limits, std::u32string src, efjsonUint8 error) {
+    efjsonStreamParser_deinit(parser);
+    efjsonStreamParser_init(parser, 0);
+    efjsonStreamParser_setLimits(parser, &limits);
+    src.push_back(U'\0');
+    size_t n = efjsonStreamParser_feed(parser, tokens, reinterpret_cast<const efjsonUint32*>(src.data()), src.size());
+    if(n != 0) return error == 0 ? -1L : -2L;
+    expect(tokens[0].extra == error, "error of the limit");
+    return static_cast<long>(efjsonStreamParser_getPosition(parser));
+  };
+  efjsonLimits limits = {};
+  limits.maxDepth = 3;
+  expect(check(limits, U"[{\"a\": [1]}]", 0) == -1, "depth within the limit");
+  expect(check(limits, U"[[[[[[1]]]]]]", efjsonError_TOO_DEEP) == 3, "depth over the limit");
+  limits = {};
+  limits.maxStringLength = 5;
+  expect(check(limits, U"[\"abcde\", \"\\\"\\n\"]", 0) == -1, "string within the limit");
+  expect(check(limits, U"[\"abcdef\"]", efjsonError_STRING_TOO_LONG) == 7, "string over the limit");
+  expect(check(limits, U"\"\\u0041\"", efjsonError_STRING_TOO_LONG) == 6, "escapes are counted as written");
+  limits = {};
+  limits.maxNumberLength = 4;
+  expect(check(limits, U"[-123, 1e10]", 0) == -1, "number within the limit");
+  expect(check(limits, U"[1, 12345678901234567890]", efjsonError_NUMBER_TOO_LONG) == 8, "number over the limit");
+  limits = {};
+  limits.maxValues = 3;
+  expect(check(limits, U"[1, []]", 0) == -1, "values within the limit");
+  expect(check(limits, U"{\"a\": 1, \"b\": 2}", efjsonError_TOO_MANY_VALUES) == 9, "values over the limit");
+  limits = {};
+  limits.maxInput = 3;
+  expect(check(limits, U"[1]", 0) == -1, "input within the limit");
+  expect(check(limits, U"[1] ", efjsonError_INPUT_TOO_LONG) == 3, "input over the limit");
+  efjsonStreamParser_destroy(parser);
+
+  /* skipped values are limited in depth as well */
+  efjson::Cursor cursor(u8"[1, [[[[\"]]]]\"]]]], 2]");
+  limits = {};
+  limits.maxDepth = 3;
+  cursor.setLimits(limits);
+  try {
+    cursor.enterArray();
+    expect(cursor.nextElement(), "first element");
+    cursor.skipValue();
+    expect(cursor.nextElement(), "second element");
+    cursor.skipValue();
+    expect(false, "skipped value too deep");
+  } catch(const efjson::JsonStreamParserException&) {
+    expect(cursor.offset() == 6, "position of the skipped value too deep");
+  }
+
+  /* the limits and the option survive a reset */
+  auto reused = std::make_unique<efjson::StreamParser>(efjsonOption_TRAILING_COMMA_IN_ARRAY);
+  limits = {};
+  limits.maxDepth = 1;
+  reused->setLimits(limits);
+  reused->feed(std::u32string_view(U"[1,]"));
+  reused->reset();
+  reused->feed(std::u32string_view(U"[2,]"));
+  reused->reset();
+  try {
+    reused->feed(std::u32string_view(U"[[3]]"));
+    expect(false, "limits after a reset");
+  } catch(const efjson::JsonStreamParserException&) {
+    expect(reused->getPosition() == 1, "position of the limit after a reset");
+  }
+
+  /* the bulk paths don't bypass the limits */
+  std::u8string escaped = u8"\"";
+  for(int i = 0; i < 1000; ++i) escaped += u8"\\u0041";
+  escaped += u8"\"";
+  limits = {};
+  limits.maxStringLength = 10;
+  efjson::Cursor strings(escaped);
+  strings.setLimits(limits);
+  try {
+    strings.getString();
+    expect(false, "escaped string too long");
+  } catch(const efjson::JsonStreamParserException&) {
+    expect(strings.getPosition() == 11, "position of the escaped string too long");
+  }
+  limits = {};
+  limits.maxInput = 100;
+  efjson::Cursor input(escaped);
+  input.setLimits(limits);
+  try {
+    input.getString();
+    expect(false, "escaped input too long");
+  } catch(const efjson::JsonStreamParserException&) {
+    expect(input.getPosition() == 100, "position of the escaped input too long");
+  }
+
+  parser = efjsonStreamParser_new(0);
+  efjsonStreamParser_setLimits(parser, &limits);
+  std::string skipped = "\"" + std::string(1000, 'a') + "\"]";
+  efjsonToken token = efjsonStreamParser_feedOne(parser, U'[');
+  size_t n = efjsonStreamParser_skipUtf8(
+    parser, &token, 0, reinterpret_cast<const efjsonUint8*>(skipped.data()), skipped.size()
+  );
+  expect(token.type == efjsonType_ERROR && token.extra == efjsonError_INPUT_TOO_LONG, "skipped input too long");
+  expect(n == 99 && efjsonStreamParser_getPosition(parser) == 100, "position of the skipped input too long");
+  efjsonStreamParser_destroy(parser);
+  std::cout << "passed\n";
+}
+
+void testFeedBudget() {
+  std::cout << "===feed budget\n";
+  std::u32string src = U"[";
+  for(int i = 0; i < 3000; ++i) src += U"12345, ";
+  src += U"0]";
+  src.push_back(U'\0');
+  std::vector<efjsonToken> tokens(src.size());
+  auto parser = efjsonStreamParser_new(0);
+  int calls = 0;
+  auto expired = [](void* opaque) { return ++*static_cast<int*>(opaque), 1; };
+  size_t i = 0, slices = 0;
+  while(i < src.size()) {
+    auto input = reinterpret_cast<const efjsonUint32*>(src.data()) + i;
+    size_t n = efjsonStreamParser_feedUntil(parser, tokens.data() + i, input, src.size() - i, expired, &calls);
+    expect(n == EFJSON_FEED_SLICE || (n != 0 && i + n == src.size()), "returns after a slice");
+    i += n;
+    ++slices;
+  }
+  expect(slices == 6 && calls == 5, "asked after every slice but the last");
+  expect(tokens.back().type == efjsonType_EOF, "fed in slices");
+  efjsonStreamParser_destroy(parser);
+
+  /* characters are never split */
+  std::u8string text = u8"[\"\u00E9\u4E2D\U0001D11E\"]";
+  efjson::StreamParser stream;
+  std::vector<efjson::Token> out;
+  for(size_t pos = 0, end = 2; pos < text.size(); end += 2) {
+    std::u8string_view view(text.data() + pos, std::min(end, text.size()) - pos);
+    pos += stream.feedSome(view, 2, std::back_inserter(out));
+  }
+  stream.end();
+  expect(out.size() == 7 && out[3].character == 0x4E2D && out[4].character == 0x1D11E, "budget in characters");
+  expect(stream.getOffset() == text.size(), "offset after the slices");
+  std::u16string wide = u"[\"\u4E2D\U0001D11E\"]";
+  auto parser16 = std::make_unique<efjson::StreamParser>();
+  out.clear();
+  for(size_t pos = 0; pos < wide.size();)
+    pos += parser16->feedSome(std::u16string_view(wide).substr(pos), 3, std::back_inserter(out));
+  expect(out.size() == 6 && out[3].character == 0x1D11E && parser16->getOffset() == wide.size() * 2, "UTF-16 slices");
+  std::cout << "passed\n";
+}
+
+void testParseFile() {
+  std::cout << "===parse file\n";
+  efjson::MappedFile file("./json/pass1.json");
+  expect(file.isMapped() && file.view().starts_with(u8"[\n"), "mapped file");
+  efjson::MappedFile moved(std::move(file));
+  expect(file.view().empty() && moved.view().size() > 1000, "moved file");
+  auto count = efjson::parseFile("./json/pass1.json", [](efjson::Cursor& cursor) {
+    size_t n = 0;
+    cursor.enterArray();
+    for(; cursor.nextElement(); ++n) cursor.skipValue();
+    return n;
+  });
+  expect(count == 20, "elements of the file");
+  size_t tokens = 0, last = 0;
+  efjson::parseFile("./json/pass1.json", [&](const efjson::Token&, size_t offset) {
+    ++tokens;
+    last = offset;
+  });
+  expect(tokens > 1000 && last == moved.view().size(), "tokens of the mapped file");
+#if defined(__linux__)
+  /* a pipe can't be mapped, it's streamed */
+  int fds[2];
+  expect(::pipe(fds) == 0, "pipe");
+  std::string text = "[1, \"\xE4\xB8\xAD\"]";
+  expect(::write(fds[1], text.data(), text.size()) == static_cast<ssize_t>(text.size()), "write");
+  ::close(fds[1]);
+  std::u32string chars;
+  efjson::parseFile("/proc/self/fd/" + std::to_string(fds[0]), [&](const efjson::Token& token) {
+    chars += static_cast<char32_t>(token.character);
+  });
+  ::close(fds[0]);
+  expect(chars == std::u32string(U"[1, \"\u4E2D\"]\0", 9), "tokens of a pipe");
+#endif
+  try {
+    efjson::parseFile("./json/not-exist.json", [](efjson::Cursor&) { });
+    expect(false, "missing file");
+  } catch(const std::system_error&) { }
+  std::cout << "passed\n";
+}
+
+void testChunkReader() {
+  std::cout << "===chunk reader\n";
+  std::string src = "[\"";
+  for(int i = 0; i < 20000; ++i) src += "\xE4\xB8\xAD"; /* U+4E2D straddles the chunks */
+  src += "\", 12345]";
+  std::istringstream stream(src);
+  auto reader = std::make_unique<efjson::ChunkReader>(stream);
+  size_t count = 0, wide = 0;
+  reader->run([&](const efjson::Token& token) {
+    ++count;
+    wide += token.character == 0x4E2D;
+  });
+  expect(count == 20000 + 12 && wide == 20000, "tokens across chunks");
+  expect(reader->getPosition() == 20000 + 11, "position");
+
+  std::istringstream broken("[1, 2\xE4\xB8");
+  reader = std::make_unique<efjson::ChunkReader>(broken);
+  try {
+    reader->run([](const efjson::Token&) { });
+    expect(false, "broken UTF-8 at the end");
+  } catch(const efjson::JsonUnicodeException&) { }
+  std::cout << "passed\n";
+}
+
+void testFeedv() {
+  std::cout << "===feedv\n";
+  std::string text = "{\"k\xC3\xA9y\": [12345678901, \"\xF0\x9D\x84\x9E\"]}";
+  /* cut inside the number and inside both multibyte sequences */
+  std::vector<std::u8string_view> fragments;
+  size_t pos = 0;
+  for(size_t cut: std::initializer_list<size_t>{ 4, 12, 26, 28, text.size() }) {
+    fragments.emplace_back(reinterpret_cast<const char8_t*>(text.data()) + pos, cut - pos);
+    pos = cut;
+  }
+  efjson::StreamParser parser;
+  auto tokens = parser.feed(fragments);
+  parser.end();
+  efjson::StreamParser whole;
+  auto expected = whole.feed(std::u8string_view(reinterpret_cast<const char8_t*>(text.data()), text.size()));
+  expect(tokens.size() == expected.size(), "tokens of fragments");
+  for(size_t i = 0; i < tokens.size(); ++i)
+    expect(tokens[i].character == expected[i].character && tokens[i].token.type == expected[i].token.type, "token");
+
+  efjsonIovec iov[2] = { { "[1, \xE2", 5 }, { "A", 1 } };
+  efjsonToken dest[6];
+  efjsonUint32 chars[6];
+  efjsonUtf8Decoder decoder;
+  efjsonUtf8Decoder_init(&decoder);
+  auto raw = efjsonStreamParser_new(0);
+  expect(efjsonStreamParser_feedv(raw, &decoder, dest, chars, iov, 2) == 0, "invalid sequence");
+  expect(dest[0].extra == efjsonError_INVALID_INPUT_UTF && efjsonStreamParser_getPosition(raw) == 4, "error");
+  efjsonStreamParser_destroy(raw);
+  std::cout << "passed\n";
+}
+
+/* a source whose chunks are delivered by hand, as an event loop would when data arrives */
+struct ManualSource {
+  std::u8string_view pending;
+  std::coroutine_handle<> waiting;
+
+  auto read() {
+    struct Awaiter {
+      ManualSource& source;
+      bool await_ready() const noexcept {
+        return false;
+      }
+      void await_suspend(std::coroutine_handle<> handle) noexcept {
+        source.waiting = handle;
+      }
+      std::u8string_view await_resume() noexcept {
+        return std::exchange(source.pending, {});
+      }
+    };
+    return Awaiter{ *this };
+  }
+  void deliver(std::u8string_view chunk) {
+    pending = chunk;
+    std::exchange(waiting, nullptr).resume();
+  }
+};
+void testParseAsync() {
+  std::cout << "===parse async\n";
+  ManualSource sources[2];
+  std::u32string texts[2];
+  auto collect = [&](int k) { return [&texts, k](const efjson::Token& token) { texts[k] += token.character; }; };
+  efjson::ParseTask tasks[2] = {
+    efjson::parseAsync(sources[0], collect(0)),
+    efjson::parseAsync(sources[1], collect(1)),
+  };
+  /* U+4E2D and a number are cut between the chunks */
+  sources[0].deliver(u8"[\"\xE4");
+  sources[1].deliver(u8"{\"a\": 12");
+  sources[0].deliver(u8"\xB8\xAD\", 1");
+  sources[1].deliver(u8"34}");
+  sources[1].deliver(u8"");
+  expect(tasks[1].done() && !tasks[0].done(), "interleaved tasks");
+  sources[0].deliver(u8"]");
+  sources[0].deliver(u8"");
+  expect(tasks[0].done(), "finished task");
+  tasks[0].get();
+  tasks[1].get();
+  expect(texts[0] == std::u32string(U"[\"\u4E2D\", 1]") + U'\0', "tokens of the first task");
+  expect(texts[1] == std::u32string(U"{\"a\": 1234}") + U'\0', "tokens of the second task");
+
+  ManualSource source;
+  auto task = efjson::parseAsync(source, [](const efjson::Token&) { });
+  source.deliver(u8"[1, ]");
+  try {
+    task.get();
+    expect(false, "error of the task");
+  } catch(const efjson::JsonStreamParserException&) { }
+  std::cout << "passed\n";
+}
+
+#if defined(__linux__)
+void testEpollParserLoop() {
+  std::cout << "===epoll parser loop\n";
+  std::vector<std::pair<int, std::u8string>> documents;
+  std::vector<std::pair<int, bool>> closed;
+  efjson::EpollParserLoop loop(
+    [&](int fd, std::u8string_view document) { documents.emplace_back(fd, document); },
+    [&](int fd, std::exception_ptr error) { closed.emplace_back(fd, error != nullptr); }
+  );
+  int pairs[2][2];
+  for(auto& pair: pairs) {
+    expect(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair) == 0, "socketpair");
+    loop.add(pair[0]);
+  }
+  auto send = [](int fd, std::string_view text) {
+    expect(::write(fd, text.data(), text.size()) == static_cast<ssize_t>(text.size()), "write");
+  };
+  auto pump = [&] {
+    while(loop.poll(0) != 0) { }
+  };
+  send(pairs[0][1], "{\"a\": [1, \"\xE4");
+  send(pairs[1][1], "[1, 2");
+  pump();
+  expect(documents.empty(), "incomplete documents");
+  send(pairs[0][1], "\xB8\xAD\"]}\n  12 tr");
+  send(pairs[1][1], ", 3]\n[}");
+  pump();
+  auto has = [&](int fd, std::u8string_view document) {
+    return std::ranges::find(documents, std::pair(fd, std::u8string(document))) != documents.end();
+  };
+  expect(documents.size() == 3 && has(pairs[0][0], u8"{\"a\": [1, \"\u4E2D\"]}"), "complete documents");
+  expect(has(pairs[0][0], u8"12") && has(pairs[1][0], u8"[1, 2, 3]"), "documents of both descriptors");
+  expect(closed.size() == 1 && closed[0] == std::pair(pairs[1][0], true), "invalid document closes the descriptor");
+  send(pairs[0][1], "ue");
+  ::close(pairs[0][1]);
+  pump();
+  expect(documents.size() == 4 && documents[3] == std::pair(pairs[0][0], std::u8string(u8"true")), "last document");
+  expect(closed.size() == 2 && closed[1] == std::pair(pairs[0][0], false) && loop.size() == 0, "end of input");
+  for(auto& pair: pairs) ::close(pair[0]);
+  ::close(pairs[1][1]);
+
+  /* `onDocument` may remove the descriptor while more documents wait in the same read */
+  documents.clear();
+  closed.clear();
+  efjson::EpollParserLoop removing(
+    [&](int fd, std::u8string_view document) {
+      documents.emplace_back(fd, document);
+      removing.remove(fd);
+    },
+    [&](int fd, std::exception_ptr error) { closed.emplace_back(fd, error != nullptr); }
+  );
+  expect(::socketpair(AF_UNIX, SOCK_STREAM, 0, pairs[0]) == 0, "socketpair");
+  removing.add(pairs[0][0]);
+  send(pairs[0][1], "[1] [2] 3 ");
+  while(removing.poll(0) != 0) { }
+  expect(documents.size() == 1 && closed.empty() && removing.size() == 0, "removed by the handler");
+
+  /* limits close the descriptor of a hostile peer */
+  documents.clear();
+  efjson::EpollParserLoop limited([&](int fd, std::u8string_view document) { documents.emplace_back(fd, document); },
+                                  [&](int fd, std::exception_ptr error) { closed.emplace_back(fd, error != nullptr); });
+  efjsonLimits limits = {};
+  limits.maxDepth = 2;
+  limited.setLimits(limits, 64);
+  expect(::socketpair(AF_UNIX, SOCK_STREAM, 0, pairs[1]) == 0, "socketpair");
+  limited.add(pairs[0][0]);
+  limited.add(pairs[1][0]);
+  send(pairs[0][1], "[[1]] [[2]] [[[3]]]");
+  send(pairs[1][1], "\"" + std::string(100, 'a'));
+  while(limited.poll(0) != 0) { }
+  expect(documents.size() == 2 && documents[1].second == u8"[[2]]", "documents within the limits");
+  expect(closed.size() == 2 && closed[0].second && closed[1].second && limited.size() == 0, "limits exceeded");
+  for(auto& pair: pairs) {
+    ::close(pair[0]);
+    ::close(pair[1]);
+  }
+
+  /* comments between documents, and the character ending a number starts the next one */
+  documents.clear();
+  closed.clear();
+  efjson::EpollParserLoop json5(
+    [&](int fd, std::u8string_view document) { documents.emplace_back(fd, document); },
+    [&](int fd, std::exception_ptr error) { closed.emplace_back(fd, error != nullptr); }, EFJSON_JSON5_OPTION
+  );
+  expect(::socketpair(AF_UNIX, SOCK_STREAM, 0, pairs[0]) == 0, "socketpair");
+  json5.add(pairs[0][0]);
+  send(pairs[0][1], "1/*c*/ 2 1//c\n2 [1]//c\n2 /*");
+  while(json5.poll(0) != 0) { }
+  send(pairs[0][1], "c*/'s'");
+  ::close(pairs[0][1]);
+  while(json5.poll(0) != 0) { }
+  std::vector<std::u8string> texts;
+  for(auto& [fd, document]: documents) texts.push_back(document);
+  expect(texts == std::vector<std::u8string>{ u8"1", u8"2", u8"1", u8"2", u8"[1]", u8"2", u8"'s'" }, "JSON5 documents");
+  expect(closed.size() == 1 && !closed[0].second, "JSON5 end of input");
+  ::close(pairs[0][0]);
+  std::cout << "passed\n";
+}
+#endif
+
+void testPipeline() {
+  std::cout << "===pipeline\n";
+  std::string src = "[\"";
+  for(int i = 0; i < 100000; ++i) src += "\xE4\xB8\xAD"; /* more chunks than the pool, straddling them */
+  src += "\", 12345]";
+  std::istringstream stream(src);
+  auto parser = std::make_unique<efjson::PipelineParser>();
+  size_t count = 0, wide = 0;
+  bool ended = false;
+  parser->run(stream, [&](const efjson::Token& token) {
+    ++count;
+    wide += token.character == 0x4E2D;
+    ended = token.token.type == efjsonType_EOF;
+  });
+  expect(count == 100000 + 12 && wide == 100000 && ended, "tokens across chunks");
+  expect(parser->getPosition() == 100000 + 11, "position");
+
+  /* a syntax error stops the I/O thread, which is still reading */
+  std::istringstream invalid("[1, 2]]" + std::string(1 << 20, ' '));
+  parser = std::make_unique<efjson::PipelineParser>();
+  try {
+    parser->run(invalid, [](const efjson::Token&) { });
+    expect(false, "syntax error");
+  } catch(const efjson::JsonStreamParserException&) {
+    expect(parser->getPosition() == 6, "error position");
+  }
+
+  std::istringstream broken("[1, 2\xE4\xB8");
+  parser = std::make_unique<efjson::PipelineParser>();
+  try {
+    parser->run(broken, [](const efjson::Token&) { });
+    expect(false, "broken UTF-8 at the end");
+  } catch(const efjson::JsonUnicodeException&) { }
+  std::cout << "passed\n";
+}
+
+void testRingParser() {
+  std::cout << "===ring parser\n";
+  std::string text = "{\"k\xC3\xA9y\": [12345678901, \"\xF0\x9D\x84\x9E\", true, null], \"\xE4\xB8\xAD\": -1.5e3}";
+  efjson::StreamParser whole;
+  auto expected = whole.feed(std::u8string_view(reinterpret_cast<const char8_t*>(text.data()), text.size()));
+  expected.push_back(whole.end());
+
+  auto ring = std::make_unique<efjson::RingParser>(10);
+  expect(ring->capacity() == 16 && ring->needMore(), "capacity");
+  std::vector<efjson::Token> tokens;
+  auto handler = [&](const efjson::Token& token) { tokens.push_back(token); };
+  size_t written = 0;
+  bool wasFull = false;
+  while(written < text.size()) {
+    /* fill the ring as far as it goes, then let the parser take 5 bytes at most */
+    for(std::span<char8_t> free; written < text.size() && !(free = ring->writable()).empty();) {
+      size_t n = std::min(free.size(), text.size() - written);
+      std::memcpy(free.data(), text.data() + written, n);
+      ring->commit(n);
+      written += n;
+    }
+    wasFull |= ring->full();
+    size_t size = ring->size();
+    expect(ring->parse(handler, 5) == std::min<size_t>(size, 5) && ring->size() == size - std::min<size_t>(size, 5),
+           "released bytes");
+  }
+  ring->end(handler);
+  expect(wasFull && ring->needMore(), "backpressure");
+  expect(tokens.size() == expected.size(), "tokens through the ring");
+  for(size_t i = 0; i < tokens.size(); ++i)
+    expect(tokens[i].character == expected[i].character && tokens[i].token.type == expected[i].token.type, "token");
+  std::cout << "passed\n";
+}
+
+void testFeedDetected() {
+  std::cout << "===feed detected\n";
+  std::u32string text = U"{\"k\u00E9y\": [1, 2.5, \"";
+  for(int i = 0; i < 700; ++i) text += i % 7 == 0 ? U'\U0001D11E' : U'\u4E2D'; /* pairs straddle the blocks */
+  text += U"\", null]}";
+  efjson::StreamParser whole;
+  auto expected = whole.feed(text);
+
+  auto encode = [&](efjson::Encoding encoding, bool bom) {
+    std::u8string out;
+    auto put = [&](uint32_t unit, int size, bool big) {
+      for(int k = 0; k < size; ++k) out += static_cast<char8_t>(unit >> (big ? (size - 1 - k) * 8 : k * 8));
+    };
+    bool big = encoding == efjson::Encoding::Utf16BE || encoding == efjson::Encoding::Utf32BE;
+    std::u32string all = bom ? U"\uFEFF" + text : text;
+    for(char32_t u: all) {
+      if(encoding == efjson::Encoding::Utf8) {
+        efjsonUint8 buf[4];
+        out.append(buf, buf + efjson_EncodeUtf8(buf, static_cast<efjsonUint32>(u)));
+      } else if(encoding == efjson::Encoding::Utf16LE || encoding == efjson::Encoding::Utf16BE) {
+        efjsonUint16 buf[2];
+        int n = efjson_EncodeUtf16(buf, static_cast<efjsonUint32>(u));
+        for(int k = 0; k < n; ++k) put(buf[k], 2, big);
+      } else {
+        put(static_cast<uint32_t>(u), 4, big);
+      }
+    }
+    return out;
+  };
+  for(auto encoding: { efjson::Encoding::Utf8, efjson::Encoding::Utf16LE, efjson::Encoding::Utf16BE,
+                       efjson::Encoding::Utf32LE, efjson::Encoding::Utf32BE }) {
+    for(bool bom: { false, true }) {
+      std::u8string src = encode(encoding, bom);
+      std::vector<efjson::Token> tokens;
+      efjson::StreamParser parser;
+      expect(parser.feedDetected(src, [&](const efjson::Token& token) { tokens.push_back(token); }) == encoding,
+             "detected encoding");
+      expect(tokens.size() == expected.size(), "tokens of the encoding");
+      for(size_t i = 0; i < tokens.size(); ++i)
+        expect(tokens[i].character == expected[i].character && tokens[i].token.type == expected[i].token.type,
+               "token");
+    }
+  }
+
+  std::u8string lone(u8"[\0\"\0\x34\xD8", 6); /* cut after a high surrogate */
+  try {
+    efjson::StreamParser().feedDetected(lone);
+    expect(false, "broken UTF-16");
+  } catch(const efjson::JsonUnicodeException&) { }
+  std::u8string surrogate(u8"[\0\0\0\0\xD8\0\0]\0\0\0", 12);
+  try {
+    efjson::StreamParser().feedDetected(surrogate);
+    expect(false, "surrogate in UTF-32");
+  } catch(const efjson::JsonUnicodeException&) { }
+  std::cout << "passed\n";
+}
+
+void testUtf8Decode() {
+  std::cout << "===utf8 decode\n";
+  std::string src;
+  for(int i = 0; i < 40; ++i) {
+    src += std::string(static_cast<size_t>(i % 19), 'a'); /* ASCII runs around the block size */
+    src += i % 3 == 0 ? "\xF0\x9D\x84\x9E" : i % 3 == 1 ? "\xC3\xA9" : "\xE4\xB8\xAD";
+  }
+  std::vector<efjsonUint32> expected, chars(src.size());
+  efjsonUtf8Decoder decoder;
+  efjsonUint32 u;
+  efjsonUtf8Decoder_init(&decoder);
+  for(char c: src)
+    if(efjsonUtf8Decoder_feed(&decoder, &u, static_cast<efjsonUint8>(c)) == 1) expected.push_back(u);
+
+  const auto* bytes = reinterpret_cast<const efjsonUint8*>(src.data());
+  for(size_t cut: { size_t(1), size_t(16), size_t(37), src.size() }) { /* a sequence may straddle two calls */
+    size_t count = 0, consumed;
+    efjsonUtf8Decoder_init(&decoder);
+    for(size_t pos = 0; pos < src.size(); pos += cut) {
+      size_t len = std::min(cut, src.size() - pos);
+      count += efjsonUtf8Decoder_decode(&decoder, chars.data() + count, bytes + pos, len, &consumed);
+      expect(consumed == len, "consumed bytes");
+    }
+    expect(count == expected.size() && std::equal(expected.begin(), expected.end(), chars.begin()), "codepoints");
+  }
+
+  std::string invalid = std::string(20, 'a') + "\xE4\xB8" + std::string(20, 'b');
+  size_t consumed;
+  efjsonUtf8Decoder_init(&decoder);
+  size_t count = efjsonUtf8Decoder_decode(
+    &decoder, chars.data(), reinterpret_cast<const efjsonUint8*>(invalid.data()), invalid.size(), &consumed
+  );
+  expect(count == 20 && consumed == 22, "invalid byte");
+
+  /* the tokens before an error are still written */
+  std::vector<efjson::Token> tokens;
+  try {
+    std::u8string_view src = u8"[1, \xFF";
+    efjson::StreamParser().feed(src.begin(), src.end(), std::back_inserter(tokens));
+    expect(false, "invalid UTF-8");
+  } catch(const efjson::JsonUnicodeException&) {
+    expect(tokens.size() == 4, "tokens before invalid UTF-8");
+  }
+  tokens.clear();
+  try {
+    std::u8string_view src = u8"[1, 2]]";
+    efjson::StreamParser().feed(src.begin(), src.end(), std::back_inserter(tokens));
+    expect(false, "syntax error");
+  } catch(const efjson::JsonStreamParserException&) {
+    expect(tokens.size() == 6 && tokens[0].character == U'[' && tokens[5].character == U']', "tokens before the error");
+  }
+  std::cout << "passed\n";
+}
+
+void testOffsets() {
+  std::cout << "===offsets\n";
+  std::string text = "{\"k\xC3\xA9y\": [\"\xF0\x9D\x84\x9E\xE4\xB8\xAD\", 12], \"\xE4\xB8\xAD\": null}";
+  auto at = [&](size_t offset) { /* decode the character at `offset` of `text` */
+    efjsonUtf8Decoder decoder;
+    efjsonUint32 u = 0;
+    efjsonUtf8Decoder_init(&decoder);
+    while(efjsonUtf8Decoder_feed(&decoder, &u, static_cast<efjsonUint8>(text[offset++])) == 0) { }
+    return u;
+  };
+  std::istringstream stream(text);
+  auto reader = std::make_unique<efjson::ChunkReader>(stream);
+  size_t last = 0;
+  reader->run([&](const efjson::Token& token, size_t offset) {
+    if(token.token.type == efjsonType_EOF) expect(offset == text.size(), "offset of EOF");
+    else expect(at(offset) == token.character && (offset == 0 || offset > last), "offset of the character");
+    last = offset;
+  });
+  expect(reader->getOffset() == text.size(), "offset at the end");
+
+  /* UTF-16 with a BOM, offsets count bytes of the original buffer */
+  std::u8string utf16(u8"\xFF\xFE[\0\"\0\x34\xD8\x1E\xDD\"\0]\0", 14);
+  auto parser = std::make_unique<efjson::StreamParser>();
+  std::vector<size_t> offsets;
+  parser->feedDetected(utf16, [&](const efjson::Token&, size_t offset) { offsets.push_back(offset); });
+  expect(offsets == std::vector<size_t>{ 2, 4, 6, 10, 12 } && parser->getOffset() == 14, "UTF-16 offsets");
+
+  /* a syntax error leaves the offset at the wrong character, across chunks */
+  std::string wrong = "[\"" + std::string(20000, 'a') + "\xC3\xA9\", x]";
+  std::istringstream invalid(wrong);
+  reader = std::make_unique<efjson::ChunkReader>(invalid);
+  try {
+    reader->run([](const efjson::Token&) { });
+    expect(false, "syntax error");
+  } catch(const efjson::JsonStreamParserException&) {
+    expect(reader->getOffset() == wrong.size() - 2, "offset of the error");
+  }
+
+  /* so does invalid input, at the start of the broken sequence */
+  parser = std::make_unique<efjson::StreamParser>();
+  try {
+    parser->feedDetected(std::u8string(u8"[\0\"\0a\0\x34\xD8]\0", 10), [](const efjson::Token&) { });
+    expect(false, "invalid UTF-16");
+  } catch(const efjson::JsonUnicodeException&) {
+    expect(parser->getOffset() == 6, "offset of invalid UTF-16");
+  }
+  parser = std::make_unique<efjson::StreamParser>();
+  try {
+    parser->feedDetected(std::u8string(u8"[\"a\xC3\"]"), [](const efjson::Token&) { });
+    expect(false, "invalid UTF-8");
+  } catch(const efjson::JsonUnicodeException&) {
+    expect(parser->getOffset() == 3, "offset of invalid UTF-8");
+  }
+  std::cout << "passed\n";
+}
+
+void testScan() {
+  std::cout << "===scan\n";
+  std::u8string src = u8"{\"id\": 12.5e3, \"na\\u006de\": \"long \\\" string\", tags: [\"a\", null, [true]], 'o': {}}";
+  efjson::Cursor cursor(src, EFJSON_JSON5_OPTION);
+  std::u8string shape;
+  auto record = [&](efjson::ScanEvent event, std::u8string_view key) {
+    static constexpr std::u8string_view NAMES[] = { u8"", u8"{", u8"}", u8"[", u8"]", u8"n", u8"b", u8"0", u8"s" };
+    if(event == efjson::ScanEvent::Key) shape.append(key).append(u8":");
+    else shape += NAMES[static_cast<int>(event)];
+  };
+  cursor.scan(record);
+  cursor.end();
+  expect(shape == u8"{id:0name:stags:[sn[b]]o:{}}", "shape");
+
+  /* containers ended by a number */
+  for(auto [text, expected]:
+      { std::pair{ u8"[1]", u8"[0]" }, { u8"{\"a\":1}", u8"{a:0}" }, { u8"[[1],23]", u8"[[0]0]" } }) {
+    auto numbers = std::make_unique<efjson::Cursor>(std::u8string_view(text));
+    shape.clear();
+    numbers->scan(record);
+    numbers->end();
+    expect(shape == expected, "shape of containers ended by a number");
+  }
+  /* the element scanned inside an array leaves the closing bracket to the caller */
+  auto inner = std::make_unique<efjson::Cursor>(u8"[12345]");
+  inner->enterArray();
+  inner->nextElement();
+  inner->scan([](efjson::ScanEvent, std::u8string_view) { });
+  expect(!inner->nextElement(), "element ended by a bracket");
+  inner->end();
+  auto wrong = std::make_unique<efjson::Cursor>(u8"[12-3]");
+  bool thrown = false;
+  try {
+    wrong->scan([](efjson::ScanEvent, std::u8string_view) { });
+  } catch(const efjson::JsonStreamParserException&) {
+    thrown = wrong->getPosition() == 3;
+  }
+  expect(thrown, "error in a number run");
+  std::cout << "passed\n";
+}
+
+void testNumberValue() {
+  std::cout << "===number value\n";
+  struct Number {
+    std::optional<int64_t> integer;
+    std::optional<double> real;
+  };
+  auto parse = [](std::u32string_view text) {
+    efjson::StreamParser parser(EFJSON_JSON5_OPTION);
+    parser.feed(text);
+    parser.end();
+    return Number{ parser.getInt64(), parser.getDouble() };
+  };
+  expect(parse(U"-9223372036854775808").integer == std::numeric_limits<int64_t>::min(), "int64 min");
+  expect(!parse(U"9223372036854775808").integer, "int64 overflow");
+  expect(!parse(U"1.0").integer && parse(U"1.0").real == 1.0, "not an integer");
+  expect(parse(U"0x7FFFFFFFFFFFFFFF").integer == std::numeric_limits<int64_t>::max(), "hexadecimal");
+  expect(parse(U"123456789012345678.25e-3").real == 123456789012345.67825, "long digits");
+  expect(parse(U"0.000000000000000000000000000000000001").real == 1e-36, "leading zeros of fraction");
+  expect(parse(U"2.2250738585072011e-308").real == 2.2250738585072011e-308, "subnormal boundary");
+  expect(parse(U"1e400").real == std::numeric_limits<double>::infinity(), "overflow to infinity");
+  expect(parse(U"-Infinity").real == -std::numeric_limits<double>::infinity(), "infinity");
+  /* exactly halfway by the first 19 digits */
+  expect(!parse(U"9007199254740993.0000000001").real, "undecided rounding");
+  efjson::Cursor cursor(u8"[9007199254740993.0000000001]");
+  cursor.enterArray();
+  cursor.nextElement();
+  expect(cursor.getDouble() == 9007199254740994.0, "fallback of undecided rounding");
+  std::cout << "passed\n";
+}
+
+void testNumberSpan() {
+  std::cout << "===number span\n";
+  /* a million digits in each part, converted in linear time without copying */
+  std::u8string src = u8"[123.4500, -12.50e+3, 0.0000001, 0.000001, 0x1FFFFFFFFFFFFFFFFFFFF, -Infinity, -1.5e-10,"
+                      u8" 12345678901234567890123, -1"
+                      + std::u8string(999999, u8'0') + u8"." + std::u8string(1000000, u8'0') + u8"e1"
+                      + std::u8string(999999, u8'0') + u8"]";
+  efjson::Cursor cursor(src, EFJSON_JSON5_OPTION);
+  auto next = [&cursor] {
+    cursor.nextElement();
+    return cursor.getNumber();
+  };
+  cursor.enterArray();
+  expect(next().toString() == "123.4500", "trailing zeros are kept");
+  expect(next().toString() == "-1.250E+4", "positive exponent");
+  expect(next().toString() == "1E-7", "small number");
+  expect(next().toString() == "0.000001", "plain small number");
+  expect(next().toString() == "2417851639229258349412351", "hexadecimal");
+  expect(next().toString() == "-Infinity", "infinity");
+
+  efjson::Number number = next();
+  expect(number.isNegative() && !number.isInteger(), "flags");
+  expect(
+    number.integerDigits() == u8"1" && number.fractionDigits() == u8"5" && number.exponentDigits() == u8"10", "digits"
+  );
+  expect(number.toDouble() == -1.5e-10, "to double");
+  number = next();
+  expect(number.isInteger() && number.toString() == "12345678901234567890123", "lossless integer");
+  expect(number.toDouble() == 12345678901234567890123.0, "long integer to double");
+  number = next();
+  expect(number.raw().data() + number.raw().size() == src.data() + src.size() - 1, "refers to the source");
+  /* adjusted exponent: 10^999999 - 1000000 + 1999999 */
+  expect(
+    number.toString() == "-1." + std::string(1999999, '0') + "E+1" + std::string(999993, '0') + "999999",
+    "giant number"
+  );
+  expect(number.toDouble() == -std::numeric_limits<double>::infinity(), "giant number to double");
+  std::cout << "passed\n";
+}
+
+void testStringAssembler() {
+  std::cout << "===string assembler\n";
+  std::u8string escapes;
+  for(int i = 0; i < 40; ++i) escapes += u8"\\u00e9\\ud83d\\ude00";
+  std::u8string expected;
+  for(int i = 0; i < 40; ++i) expected += u8"\u00e9\U0001F600";
+  std::u8string src = u8"[\"plain \u00e9 text\", \"a\\tb\\\"c\\\\\", \"" + escapes + u8"end\", {\\u0061b: \"x\\ny\"}]";
+  {
+    efjson::Cursor cursor(src, EFJSON_JSON5_OPTION);
+    cursor.enterArray();
+    cursor.nextElement();
+    std::u8string_view plain = cursor.getString();
+    expect(plain == u8"plain \u00e9 text" && plain.data() == src.data() + 2, "no escape, zero copy");
+    cursor.nextElement();
+    expect(cursor.getString() == u8"a\tb\"c\\", "simple escapes");
+    cursor.nextElement();
+    expect(cursor.getString() == expected + u8"end", "long run of escapes");
+    cursor.nextElement();
+    cursor.enterObject();
+    expect(cursor.nextKey() == u8"ab", "escaped identifier");
+    expect(cursor.getString() == u8"x\ny", "escape in the middle");
+  }
+  efjson::LazyDocument doc(src, EFJSON_JSON5_OPTION);
+  expect(doc.root()[2].get<std::u8string_view>() == expected + u8"end", "lazy document");
+  expect(doc.root()[3][u8"ab"].get<std::u8string_view>() == u8"x\ny", "lazy document identifier");
+  bool thrown = false;
+  try {
+    efjson::Cursor cursor(u8R"("\u00e9\ud83d\u0041")");
+    cursor.getString();
+  } catch(const efjson::JsonStreamParserException&) {
+    thrown = true;
+  }
+  expect(thrown, "incomplete surrogate pair after escapes");
+  std::cout << "passed\n";
+}
+
+void testInSitu() {
+  std::cout << "===in situ\n";
+  const std::u8string text = u8"{\"a\\u0062\": [\"x\\ty\\u00e9\\ud83d\\ude00z\", \"plain\", 1.5], k\\u0065y: \"\\\"\"}";
+  auto inside = [](std::u8string_view view, const std::u8string& buffer) {
+    return view.data() >= buffer.data() && view.data() + view.size() <= buffer.data() + buffer.size();
+  };
+  {
+    std::u8string buffer = text;
+    efjson::Cursor cursor(efjson::inSitu, buffer, EFJSON_JSON5_OPTION);
+    cursor.enterObject();
+    std::u8string_view key = *cursor.nextKey();
+    cursor.enterArray();
+    cursor.nextElement();
+    std::u8string_view first = cursor.getString();
+    cursor.nextElement();
+    std::u8string_view second = cursor.getString();
+    cursor.nextElement();
+    expect(cursor.getDouble() == 1.5 && !cursor.nextElement(), "number after decoded strings");
+    std::u8string_view identifier = *cursor.nextKey();
+    std::u8string_view last = cursor.getString();
+    /* all the views stay valid */
+    expect(key == u8"ab" && first == u8"x\ty\u00e9\U0001F600z" && second == u8"plain", "decoded strings");
+    expect(identifier == u8"key" && last == u8"\"", "decoded identifier");
+    expect(inside(key, buffer) && inside(first, buffer) && inside(identifier, buffer), "views of the buffer");
+  }
+  std::u8string buffer = text;
+  efjson::LazyDocument doc(efjson::inSitu, buffer, EFJSON_JSON5_OPTION);
+  auto root = doc.root();
+  expect(root[u8"ab"][0].get<std::u8string_view>() == u8"x\ty\u00e9\U0001F600z", "document string");
+  expect(root[u8"ab"][1].get<std::u8string_view>() == u8"plain" && root[u8"ab"][2].get<double>() == 1.5, "document");
+  expect(root[u8"key"].get<std::u8string_view>() == u8"\"" && root[u8"key"].size() == 0, "document identifier");
+  expect(inside(root[u8"ab"][0].get<std::u8string_view>(), buffer), "document views the buffer");
+  std::cout << "passed\n";
+}
+
+void testPathTracker() {
+  std::cout << "===path tracker\n";
+  std::u32string src = U"{\"a\": [1, {b\\u0063: 2, // note\n \"d\\u00e9\" : [true]}], 'e': null}";
+  auto parser = std::make_unique<efjson::StreamParser>(EFJSON_JSON5_OPTION);
+  efjson::PathTracker tracker;
+  int seen = 0;
+  for(char32_t c: src) {
+    auto token = parser->feedOne(c);
+    tracker.feed(token);
+    switch(static_cast<efjson::TokenType>(token.token.type)) {
+    case efjson::TokenType::NumberIntegerDigit:
+      if(c == U'2') {
+        expect(tracker.depth() == 3 && tracker[0].hash == efjson::PathTracker::hashKey(u8"a"), "depth 0");
+        expect(!tracker[1].object && tracker[1].index == 1, "depth 1");
+        expect(tracker[2].object && tracker[2].hash == efjson::PathTracker::hashKey(u8"bc"), "escaped identifier");
+        ++seen;
+      }
+      break;
+    case efjson::TokenType::True:
+      if(token.token.done) {
+        expect(tracker.depth() == 4 && tracker[2].index == 1, "member index");
+        expect(tracker[2].hash == efjson::PathTracker::hashKey(u8"d\u00e9") && tracker[3].index == 0, "escaped key");
+        ++seen;
+      }
+      break;
+    case efjson::TokenType::Null:
+      if(token.token.done) {
+        expect(tracker.depth() == 1 && tracker[0].hash == efjson::PathTracker::hashKey(u8"e"), "after nesting");
+        expect(tracker[0].index == 1 && !tracker.inKey(), "second member");
+        ++seen;
+      }
+      break;
+    default:
+      break;
+    }
+  }
+  parser->end();
+  expect(seen == 3 && tracker.depth() == 0, "path tracker");
+  std::cout << "passed\n";
+}
+
+void testProjection() {
+  std::cout << "===projection\n";
+  std::u8string src = u8R"({"meta": {"skip": [1, {"id": 0}]}, "user": {"id": 1234, "a/b": "x", "m~n": [true]},
+    "entities": {"urls": [{"url": "https://a.example"}, {"url": "b"}]}, "tail": [1, 2]})";
+  std::vector<std::u8string> values(6);
+  efjson::Projection projection{
+    u8"/user/id", u8"/entities/urls/0/url", u8"/user/a~1b", u8"/user/m~0n/0", u8"/user", u8"/missing",
+  };
+  size_t matched = projection.run(src, [&](size_t i, std::u8string_view value) { values[i] = value; });
+  expect(matched == 5 && values[0] == u8"1234" && values[1] == u8"\"https://a.example\"", "projected values");
+  expect(values[2] == u8"\"x\"" && values[3] == u8"true" && values[4].starts_with(u8"{\"id\"") && values[5].empty(),
+         "escaped pointers and nested matches");
+  /* stops after the last match, so the broken tail is never read */
+  std::u8string broken = src.substr(0, src.find(u8"\"tail\""));
+  efjson::Projection early{ u8"/meta/skip/1/id", u8"/user/m~0n" };
+  matched = early.run(broken, [&](size_t i, std::u8string_view value) { values[i] = value; });
+  expect(matched == 2 && values[0] == u8"0" && values[1] == u8"[true]", "early stop");
+  bool thrown = false;
+  try {
+    efjson::Projection bad{ u8"user" };
+  } catch(const efjson::JsonValueException&) {
+    thrown = true;
+  }
+  expect(thrown, "bad pointer");
+  std::cout << "passed\n";
+}
+
+void testJsonPath() {
+  std::cout << "===json path\n";
+  std::u8string src = u8R"({"statuses": [
+    {"id": 1, "lang": "en", "user": {"id": 10, "screen_name": "a"}},
+    {"user": {"id": 11, "screen_name": "b"}, "lang": "ja", "id": 2},
+    {"id": 3, "user": {"screen_name": "c", "id": 12}, "lang": "en", "extra": [{"id": 4}]}
+  ], "search_metadata": {"count": 3}})";
+  auto query = [&](const char8_t* path) {
+    std::u8string values;
+    efjson::JsonPath(std::u8string_view(path)).run(src, [&](std::u8string_view value) {
+      values += value;
+      values += u8' ';
+    });
+    return values;
+  };
+  expect(query(u8"$.statuses[*].user.screen_name") == u8"\"a\" \"b\" \"c\" ", "wildcard");
+  expect(query(u8"$..id") == u8"1 10 11 2 3 12 4 ", "recursive descent");
+  expect(query(u8"$.statuses[?(@.lang=='en')].user.screen_name") == u8"\"a\" \"c\" ", "filter after the selected");
+  expect(query(u8"$.statuses[?(@.user.id >= 11)].id") == u8"2 3 ", "nested filter");
+  expect(query(u8"$.statuses[?@.extra]..id") == u8"3 12 4 ", "existence filter");
+  expect(query(u8"$['search_metadata'].count") == u8"3 " && query(u8"$.statuses[1].lang") == u8"\"ja\" ", "brackets");
+  expect(query(u8"$..[2].extra").starts_with(u8"[{") && query(u8"$.missing") == u8"", "container match");
+  expect(query(u8"$.statuses[?(@.id >= 2)].extra[?(@.id == 4)].id") == u8"4 ", "filters one in another");
+  expect(query(u8"$.statuses[0].user[?(@.x != 1)]") == u8"10 \"a\" ", "filter on scalars");
+  bool thrown = false;
+  try {
+    efjson::JsonPath path(u8"$.statuses[");
+  } catch(const efjson::JsonValueException&) {
+    thrown = true;
+  }
+  expect(thrown, "bad path");
+  std::cout << "passed\n";
+}
+
 int main() {
   // testJson();
   testJson5();
+  testLazyDocument();
+  testCursor();
+  testSkip();
+  testBracketRuns();
+  testScan();
+  testLimits();
+  testFeedBudget();
+  testParseFile();
+  testChunkReader();
+  testFeedv();
+  testParseAsync();
+  testPipeline();
+  testRingParser();
+  testFeedDetected();
+  testUtf8Decode();
+  testOffsets();
+#if defined(__linux__)
+  testEpollParserLoop();
+#endif
+  testNumberValue();
+  testNumberSpan();
+  testStringAssembler();
+  testInSitu();
+  testPathTracker();
+  testProjection();
+  testJsonPath();
   return 0;
 }